@@ -0,0 +1,238 @@
+// Standard Library Headers
+#include <algorithm>
+#include <cmath>
+
+// Project Headers
+#include "animation_page_warmer.h"
+
+//----------------------------------------------------------------------
+// Internal Utility Functions
+
+namespace
+{
+
+constexpr size_t kPageSize = 4096;
+constexpr unsigned kMaxWorkers = 4; // Heavy caches are bound by disk reads, which more threads keep busier
+
+// Zero-copy arrays from usdc files still point into the mapped file; touch every page so it is read now
+void TouchPages(const void *data, size_t size)
+{
+    const volatile char *bytes = static_cast<const volatile char *>(data);
+    char sink = 0;
+    for (size_t offset = 0; offset < size; offset += kPageSize)
+    {
+        sink ^= bytes[offset];
+    }
+    (void)sink;
+}
+
+} // namespace
+
+//----------------------------------------------------------------------
+// AnimationPageWarmer::PauseScope Class Implementation
+
+AnimationPageWarmer::PauseScope::PauseScope(AnimationPageWarmer *warmer) : m_warmer(warmer)
+{
+    if (m_warmer)
+    {
+        m_warmer->Pause();
+    }
+}
+
+AnimationPageWarmer::PauseScope::~PauseScope()
+{
+    if (m_warmer)
+    {
+        m_warmer->Resume();
+    }
+}
+
+//----------------------------------------------------------------------
+// AnimationPageWarmer Class Implementation
+
+AnimationPageWarmer::AnimationPageWarmer(const pxr::UsdStageRefPtr &stage, uint32_t lookaheadFrames)
+    : m_stage(stage), m_lookaheadFrames(lookaheadFrames), m_startTimeCode(stage->GetStartTimeCode()),
+      m_endTimeCode(stage->GetEndTimeCode()), m_playhead(stage->GetStartTimeCode())
+{
+    // A quarter of the cores, so the workers don't compete with Hydra's sync
+    unsigned workerCount = std::clamp(std::thread::hardware_concurrency() / 4, 1u, kMaxWorkers);
+    for (unsigned i = 0; i < workerCount; ++i)
+    {
+        m_workers.emplace_back(&AnimationPageWarmer::WorkerLoop, this);
+    }
+}
+
+AnimationPageWarmer::~AnimationPageWarmer()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_quit = true;
+    }
+    m_condition.notify_all();
+    for (std::thread &worker : m_workers)
+    {
+        worker.join();
+    }
+}
+
+void AnimationPageWarmer::SetPlayhead(double time, double frameStep)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (time == m_playhead && frameStep == m_frameStep)
+        {
+            return;
+        }
+
+        // Frames already read ahead stay valid if playback moved forward into them
+        double advanced = std::round((time - m_playhead) / frameStep);
+        if (frameStep == m_frameStep && advanced > 0.0 && advanced <= m_framesAhead)
+        {
+            m_framesAhead -= static_cast<uint32_t>(advanced);
+        }
+        else
+        {
+            m_framesAhead = 0;
+        }
+        m_playhead = time;
+        m_frameStep = frameStep;
+    }
+    m_condition.notify_all();
+}
+
+void AnimationPageWarmer::Pause()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_pauseCount++;
+    m_interrupt = true;
+    m_condition.wait(lock, [this] { return m_busyCount == 0; });
+}
+
+void AnimationPageWarmer::Resume()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_pauseCount--;
+        m_interrupt = m_pauseCount > 0;
+        m_needsCollect = true;
+        m_framesAhead = 0;
+    }
+    m_condition.notify_all();
+}
+
+void AnimationPageWarmer::WorkerLoop()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true)
+    {
+        // Collecting waits for the other workers to finish their frames, and they wait for the new list
+        m_condition.wait(lock, [this] {
+            if (m_quit)
+            {
+                return true;
+            }
+            if (m_pauseCount > 0 || m_collecting)
+            {
+                return false;
+            }
+            return m_needsCollect ? m_busyCount == 0 : m_framesAhead < m_lookaheadFrames;
+        });
+        if (m_quit)
+        {
+            break;
+        }
+
+        m_busyCount++;
+        if (m_needsCollect)
+        {
+            m_needsCollect = false;
+            m_collecting = true;
+            lock.unlock();
+            bool collected = CollectAttributes();
+            lock.lock();
+            m_collecting = false;
+            m_needsCollect = m_needsCollect || !collected;
+        }
+        else
+        {
+            // Loop back to the start like the timeline does
+            double time = m_playhead + (++m_framesAhead) * m_frameStep;
+            if (time > m_endTimeCode)
+            {
+                double loopLength = m_endTimeCode - m_startTimeCode + m_frameStep;
+                time = m_startTimeCode + std::fmod(time - m_startTimeCode, loopLength);
+            }
+            lock.unlock();
+            WarmFrame(time);
+            lock.lock();
+        }
+        m_busyCount--;
+        m_condition.notify_all();
+    }
+}
+
+bool AnimationPageWarmer::CollectAttributes()
+{
+    m_attributes.clear();
+    for (const pxr::UsdPrim &prim : m_stage->Traverse())
+    {
+        if (m_interrupt)
+        {
+            m_attributes.clear();
+            return false;
+        }
+
+        std::vector<pxr::UsdAttribute> candidates;
+        if (pxr::UsdGeomPointBased pointBased{prim})
+        {
+            candidates.push_back(pointBased.GetPointsAttr());
+        }
+        if (pxr::UsdGeomXformable xformable{prim})
+        {
+            bool resetsXformStack = false;
+            for (const pxr::UsdGeomXformOp &op : xformable.GetOrderedXformOps(&resetsXformStack))
+            {
+                candidates.push_back(op.GetAttr());
+            }
+        }
+        if (pxr::UsdGeomImageable imageable{prim})
+        {
+            candidates.push_back(imageable.GetVisibilityAttr());
+        }
+
+        for (const pxr::UsdAttribute &attribute : candidates)
+        {
+            if (attribute.ValueMightBeTimeVarying())
+            {
+                m_attributes.push_back(attribute);
+            }
+        }
+    }
+    return true;
+}
+
+void AnimationPageWarmer::WarmFrame(double time) const
+{
+    // The values are dropped; reading them is what pulls their pages in
+    pxr::UsdTimeCode timeCode(time);
+    for (const pxr::UsdAttribute &attribute : m_attributes)
+    {
+        if (m_interrupt)
+        {
+            return;
+        }
+        if (attribute.GetTypeName() == pxr::SdfValueTypeNames->Point3fArray)
+        {
+            pxr::VtVec3fArray points;
+            if (attribute.Get(&points, timeCode))
+            {
+                TouchPages(points.cdata(), points.size() * sizeof(pxr::GfVec3f));
+            }
+        }
+        else
+        {
+            pxr::VtValue value;
+            attribute.Get(&value, timeCode);
+        }
+    }
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+// Standard Library Headers
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Project Headers
+#include "usd_headers.h"
+
+// AnimationPageWarmer Class
+//
+// Warms the OS page cache ahead of animation playback. Worker threads read the time samples of animated points,
+// transforms and visibility a number of frames ahead of the playhead, each worker taking the next frame, and
+// touch every page of the zero-copy usdc arrays they get back. Nothing read is kept: Hydra still reads, and for
+// compressed arrays decodes, every sample itself on the render thread, so this hides disk reads, not decoding.
+// Reading the stage concurrently with rendering is safe, editing it is not: the render thread must hold a
+// PauseScope around any stage edit.
+class AnimationPageWarmer
+{
+  public:
+    // Blocks the workers for the lifetime of the scope; stage edits must happen inside one
+    class PauseScope
+    {
+      public:
+        explicit PauseScope(AnimationPageWarmer *warmer);
+        ~PauseScope();
+
+        PauseScope(const PauseScope &) = delete;
+        PauseScope &operator=(const PauseScope &) = delete;
+
+      private:
+        AnimationPageWarmer *m_warmer; // Non-owning pointer, may be null
+    };
+
+    // Constructor and Destructor
+    AnimationPageWarmer(const pxr::UsdStageRefPtr &stage, uint32_t lookaheadFrames);
+    ~AnimationPageWarmer();
+
+    // Deleted Functions
+    AnimationPageWarmer(const AnimationPageWarmer &) = delete;
+    AnimationPageWarmer &operator=(const AnimationPageWarmer &) = delete;
+
+    /// Tells the workers which time is on screen; they read ahead from there in steps of `frameStep`.
+    void SetPlayhead(double time, double frameStep);
+
+  private:
+    void Pause();
+    void Resume();
+    void WorkerLoop();
+    bool CollectAttributes();
+    void WarmFrame(double time) const;
+
+    pxr::UsdStageRefPtr m_stage;
+    uint32_t m_lookaheadFrames;
+    double m_startTimeCode;
+    double m_endTimeCode;
+    std::vector<pxr::UsdAttribute> m_attributes; // Written by one worker while no other one reads it
+
+    // Workers
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    double m_playhead;
+    double m_frameStep = 1.0;
+    uint32_t m_framesAhead = 0; // Frames after the playhead that have been claimed by a worker
+    uint32_t m_pauseCount = 0;
+    uint32_t m_busyCount = 0;             // Workers reading from the stage
+    std::atomic<bool> m_interrupt{false}; // Set while paused, so long reads stop early
+    bool m_needsCollect = true;           // The stage changed; gather the animated attributes again
+    bool m_collecting = false;
+    bool m_quit = false;
+    std::vector<std::thread> m_workers; // Last, so they start after the state above is constructed
+};
@@ -1,7 +1,12 @@
 // Standard Library Headers
 #include <algorithm>
+#include <cstdio>
+#include <ctime>
 #include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <set>
+#include <vector>
 
 // Third-Party Library Headers
 #include <glad/glad.h>
@@ -11,10 +16,31 @@
 
 // Project Headers
 #include "application.h"
+#include "disk_cache.h"
+#include "frame_timings.h"
+#include "memory_resolver.h"
+#include "memory_usage.h"
+#include "prim_outline.h"
 
 // Static Application Instance
 Application *Application::s_instance = nullptr;
 
+// Constants
+namespace
+{
+const pxr::GfVec4f kClearColor(0.09f, 0.24f, 0.43f, 1.0f);
+const glm::vec4 kPlaceholderColor(1.0f, 0.8f, 0.3f, 1.0f);
+const pxr::SdfPath kModelPath("/World/Model");
+const pxr::SdfPath kDomeLightPath("/World/DomeLight");
+constexpr uint32_t kSceneSwitchCount = 6; // Switches timed by --switch-scene (three round trips)
+constexpr uint32_t kScalingRuns = 3;      // Loads timed per thread count by --scaling (the fastest counts)
+constexpr uint32_t kPresentFrames = 200;  // Frames timed per size and path by --present-benchmark
+constexpr uint32_t kPresentWarmup = 20;   // Frames rendered before each of those runs
+constexpr int kPresentSizes[][2] = {{1920, 1080}, {3840, 2160}};
+constexpr double kIdleWaitSeconds = 0.5;   // Event wait when nothing is changing
+constexpr double kBusyWaitSeconds = 0.01;  // Event wait while loads run in the background
+} // namespace
+
 //----------------------------------------------------------------------
 // Internal Utility Functions
 
@@ -56,37 +82,6 @@ void KeyCallback(GLFWwindow *window, int key, int scancode, int action, int mods
     }
 }
 
-void ComputeSceneBounds(const pxr::UsdStageRefPtr &stage, glm::vec3 &minBounds, glm::vec3 &maxBounds)
-{
-    if (!stage)
-    {
-        std::cerr << "ComputeSceneBounds: stage is null." << std::endl;
-        return;
-    }
-
-    pxr::UsdPrim pseudoRoot = stage->GetPseudoRoot();
-    if (!pseudoRoot)
-    {
-        std::cerr << "ComputeSceneBounds: pseudo-root is null." << std::endl;
-        return;
-    }
-
-    pxr::GfBBox3d bbox;
-    {
-        pxr::UsdGeomBBoxCache bboxCache(pxr::UsdTimeCode::Default(), pxr::UsdGeomImageable::GetOrderedPurposeTokens(),
-                                        /* useExtentsHint = */ true);
-        bbox = bboxCache.ComputeWorldBound(pseudoRoot);
-    }
-
-    pxr::GfRange3d range = bbox.GetRange();
-    minBounds = glm::vec3(range.GetMin()[0], range.GetMin()[1], range.GetMin()[2]);
-    maxBounds = glm::vec3(range.GetMax()[0], range.GetMax()[1], range.GetMax()[2]);
-
-    // Print the bounds
-    std::cout << "Scene Bounds: " << minBounds.x << ", " << minBounds.y << ", " << minBounds.z << " to " << maxBounds.x
-              << ", " << maxBounds.y << ", " << maxBounds.z << std::endl;
-}
-
 pxr::GfMatrix4d ToGfMatrix(const glm::mat4 &m)
 {
     pxr::GfMatrix4d result;
@@ -114,6 +109,40 @@ pxr::GfMatrix4d ExpandTo4x4(const glm::mat3 &m)
     return result;
 }
 
+double ElapsedMs(std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end)
+{
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// Estimated memory traffic of presenting one frame. An HgiInterop composite reads the AOV and blends it over the
+// framebuffer (a read and a write); the interop path clears the framebuffer, then composites in the engine's
+// present task and again in TransferToApp. The direct blit reads the AOV and writes the framebuffer once.
+double EstimatePresentBytes(bool direct, double aovBytes, double framebufferBytes)
+{
+    return direct ? aovBytes + framebufferBytes : framebufferBytes + 2.0 * (aovBytes + 2.0 * framebufferBytes);
+}
+
+// Reads a whole file into a new buffer; returns null on failure
+std::shared_ptr<const char> ReadFileBuffer(const std::string &filename, size_t &size)
+{
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    if (!file)
+    {
+        std::cerr << "Failed to open " << filename << std::endl;
+        return nullptr;
+    }
+
+    size = static_cast<size_t>(file.tellg());
+    std::shared_ptr<char> buffer(new char[size], std::default_delete<char[]>());
+    file.seekg(0);
+    if (!file.read(buffer.get(), size))
+    {
+        std::cerr << "Failed to read " << filename << std::endl;
+        return nullptr;
+    }
+    return buffer;
+}
+
 // Convert one sRGB channel into linear space:
 static float SrgbToLinear(float cs) {
     if (cs <= 0.04045f) {
@@ -144,10 +173,32 @@ Application *Application::GetInstance()
     return s_instance;
 }
 
-Application::Application(uint32_t width, uint32_t height) : m_windowWidth(width), m_windowHeight(height)
+Application::Application(uint32_t width, uint32_t height, const Options &options)
+    : m_options(options), m_windowWidth(width), m_windowHeight(height),
+      m_resolution(ResolutionController::Settings{options.frameBudgetMs}),
+      m_sceneLoader(static_cast<size_t>(options.sceneCacheDiskMB) << 20),
+      m_loadProfiler(options.loadReportFile, options.loadTraceFile),
+      m_environmentLoader(GetUserCacheDirectory("environments"))
 {
     assert(!s_instance); // Ensure only one instance exists
     s_instance = this;
+
+    // Caps OpenUSD's dispatcher and every TBB arena, including the ones below
+    if (options.threads > 0)
+    {
+        pxr::WorkSetConcurrencyLimit(options.threads);
+    }
+
+    // Keep background loads from taking the workers Hydra needs to sync the frame being drawn
+    int threadLimit = static_cast<int>(pxr::WorkGetConcurrencyLimit());
+    int renderThreads = std::min(static_cast<int>(options.renderThreads), threadLimit);
+    if (renderThreads > 0)
+    {
+        m_renderArena = std::make_unique<tbb::task_arena>(renderThreads);
+        m_sceneLoader.SetConcurrency(std::max(1, threadLimit - renderThreads));
+        std::cout << "Threads: " << renderThreads << " for rendering, " << std::max(1, threadLimit - renderThreads)
+                  << " for loading" << std::endl;
+    }
 }
 
 Application::~Application()
@@ -160,11 +211,18 @@ Application::~Application()
     s_instance = nullptr;
 }
 
-void Application::Run()
+bool Application::Run()
 {
+    if (m_options.headless)
+    {
+        // No display server: the null platform still creates an offscreen context through EGL or OSMesa
+        glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+    }
+
     if (!glfwInit())
     {
-        return;
+        std::cerr << "Failed to initialize GLFW" << std::endl;
+        return false;
     }
 
 #if defined(__APPLE__)
@@ -174,15 +232,32 @@ void Application::Run()
     glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
 #endif
 
+    if (m_options.headless)
+    {
+        glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+        glfwWindowHint(GLFW_CONTEXT_CREATION_API, m_options.headlessApi == HeadlessApi::OSMesa
+                                                      ? GLFW_OSMESA_CONTEXT_API
+                                                      : GLFW_EGL_CONTEXT_API);
+    }
+
+    // The driver reads its shader cache settings when the context is created
+    std::string shaderCacheDir;
+    if (m_options.shaderCache)
+    {
+        shaderCacheDir =
+            m_options.shaderCacheDir.empty() ? GetUserCacheDirectory("shaders") : m_options.shaderCacheDir;
+        EnableDriverShaderCache(shaderCacheDir);
+    }
+
     // Create a windowed mode window and its OpenGL context
     m_window = glfwCreateWindow(m_windowWidth, m_windowHeight, "USD Viewer", nullptr, nullptr);
     if (!m_window)
     {
         std::cerr << "Failed to create GLFW window" << std::endl;
         glfwTerminate();
-        return;
+        return false;
     }
- 
+
     // Make the window's context current
     glfwMakeContextCurrent(m_window);
 
@@ -193,7 +268,7 @@ void Application::Run()
     if (!gladLoadGL())
     {
         std::cerr << "Failed to initialize GLAD" << std::endl;
-        return;
+        return false;
     }
 
     glEnable(GL_DEPTH_TEST);
@@ -207,11 +282,21 @@ void Application::Run()
     std::cout << "OpenGL Renderer: " << glGetString(GL_RENDERER) << "\n";
     std::cout << "OpenGL Vendor: " << glGetString(GL_VENDOR) << "\n";
 
+    // GL timer queries for the frame profiler
+    m_profiler.InitGpuTiming();
+
+    // Placeholder bounds for scenes that are still loading
+    m_programCache = std::make_unique<ProgramCache>(shaderCacheDir);
+    m_boundsOverlay = std::make_unique<BoundsOverlay>(*m_programCache);
+
     // Handle high-DPI/Retina displays
     int actualWidth, actualHeight;
     glfwGetWindowSize(m_window, &actualWidth, &actualHeight);
     OnResize(actualWidth, actualHeight);
 
+    // Also creates the offscreen framebuffers of headless mode, as surfaceless contexts have no default one
+    SetFrameLatency(m_options.frameLatency);
+
     // Setup input callbacks
     m_controls = std::make_unique<OrbitControls>(m_window, &m_camera);
     glfwSetKeyCallback(m_window, KeyCallback);
@@ -230,11 +315,40 @@ void Application::Run()
     // Initialize GL Context Capabilities
     pxr::GlfContextCaps::InitInstance();
 
-    // Load the default scene
-    LoadScene("assets/Kitchen_set/Kitchen_set.usd");
+    // Headless mode loads the scene up front, renders a fixed number of frames and exits
+    if (m_options.headless)
+    {
+        if (!m_options.batchManifestFile.empty())
+        {
+            return RunBatchBenchmark();
+        }
+        if (m_options.scalingBenchmark)
+        {
+            return RunScalingBenchmark();
+        }
+        if (m_options.presentBenchmark)
+        {
+            return RunPresentBenchmark();
+        }
+        if (m_options.warmShaderCache)
+        {
+            // The first frame compiles every program the scene needs, which the caches then keep
+            std::cout << "Warming the shader cache in " << shaderCacheDir << std::endl;
+        }
+        LoadScene(m_options.sceneFile);
+        if (!m_options.captureDir.empty() && !m_options.warmShaderCache)
+        {
+            return RunTurntableCapture();
+        }
+        return RunBenchmark();
+    }
+
+    // Load the initial scene in the background
+    RequestScene(m_options.sceneFile);
 
     // Enter the main loop
     MainLoop();
+    return true;
 }
 
 void Application::OnKeyPressed(int key, int mods)
@@ -243,12 +357,90 @@ void Application::OnKeyPressed(int key, int mods)
     {
         m_quitApp = true;
     }
-    else if (key == GLFW_KEY_HOME)
+    else if (key == GLFW_KEY_HOME && m_boundsCache)
     {
         glm::vec3 minBounds, maxBounds;
-        ComputeSceneBounds(m_stage, minBounds, maxBounds);
+        ComputeSceneBounds(*m_boundsCache, minBounds, maxBounds, m_timeline.GetTime());
         m_camera.ResetToModel(minBounds, maxBounds);
     }
+    else if (key == GLFW_KEY_F)
+    {
+        FrameSelection();
+    }
+    else if (key == GLFW_KEY_SPACE)
+    {
+        m_timeline.TogglePlay();
+    }
+    else if (key == GLFW_KEY_LEFT || key == GLFW_KEY_RIGHT)
+    {
+        m_timeline.Step(key == GLFW_KEY_LEFT ? -1 : 1);
+        m_redrawRequested = true;
+    }
+    else if (key == GLFW_KEY_R)
+    {
+        ToggleCameraRecording();
+    }
+    else if (key == GLFW_KEY_P)
+    {
+        m_profiler.PrintReport();
+        if (m_payloadStreamer)
+        {
+            m_payloadStreamer->PrintStatus();
+        }
+    }
+    else if (key == GLFW_KEY_T)
+    {
+        m_profiler.ExportChromeTrace("frame_trace.json");
+    }
+    else if (key == GLFW_KEY_F12)
+    {
+        TakeScreenshot();
+    }
+    else if (key == GLFW_KEY_L)
+    {
+        m_options.adaptiveLod = !m_options.adaptiveLod;
+        m_redrawRequested = true;
+        std::cout << "Adaptive LOD " << (m_options.adaptiveLod ? "on" : "off")
+                  << (m_sceneHasProxies ? "" : " (the scene has no proxy geometry)") << std::endl;
+    }
+    else if (key == GLFW_KEY_I)
+    {
+        // Isolate the selection, or go back to rendering everything
+        bool isolate = !m_selectedPath.IsEmpty() && m_renderRoot.IsAbsoluteRootPath();
+        SetIsolation(isolate ? m_selectedPath : pxr::SdfPath::AbsoluteRootPath(), m_excludedPaths);
+        FrameSelection();
+    }
+    else if (key == GLFW_KEY_H)
+    {
+        // Hide the selection; Shift+H shows everything that was hidden
+        if (mods & GLFW_MOD_SHIFT)
+        {
+            SetIsolation(m_renderRoot, pxr::SdfPathVector());
+        }
+        else if (!m_selectedPath.IsEmpty())
+        {
+            pxr::SdfPathVector excludedPaths = m_excludedPaths;
+            excludedPaths.push_back(m_selectedPath);
+            m_selectedPath = pxr::SdfPath();
+            SetIsolation(m_renderRoot, excludedPaths);
+        }
+    }
+    else if (key == GLFW_KEY_M)
+    {
+        // Reload only the selection; Shift+M reloads the whole scene
+        if (mods & GLFW_MOD_SHIFT)
+        {
+            SetPopulationMask({});
+        }
+        else if (!m_selectedPath.IsEmpty())
+        {
+            SetPopulationMask({m_selectedPath.GetString()});
+        }
+    }
+    else if (key == GLFW_KEY_O)
+    {
+        PrintOutline();
+    }
 }
 
 void Application::OnResize(int width, int height)
@@ -256,6 +448,7 @@ void Application::OnResize(int width, int height)
     m_windowWidth = width;
     m_windowHeight = height;
     m_camera.ResizeViewport(width, height);
+    m_redrawRequested = true;
 
     // Framebuffer size - may differ from window size on high-DPI displaysdow size on high-DPI displays
     int framebufferWidth, framebufferHeight;
@@ -272,14 +465,19 @@ void Application::OnFileDropped(const std::string &filename, uint8_t *data, int
 
     if (ext == ".exr" || ext == ".hdr")
     {
-        // Reload dome light texture
-        m_domeLightTexture = filename;
-        InitHydra();
+        // Decoded and reduced on a worker; the dome light is updated in place once that is done
+        m_environmentLoader.Request(filename);
+    }
+    else if ((ext == ".usd" || ext == ".usda" || ext == ".usdc" || ext == ".usdz") && data && length > 0)
+    {
+        // Bytes handed over by an embedding process: open them in place, the caller keeps ownership
+        std::shared_ptr<const char> buffer(reinterpret_cast<const char *>(data), [](const char *) {});
+        RequestScene(RegisterMemoryAsset(filename, std::move(buffer), static_cast<size_t>(length)));
     }
     else if (ext == ".usd" || ext == ".usda" || ext == ".usdc" || ext == ".usdz")
     {
-        // Load USD scene
-        LoadScene(filename);
+        // Load USD scene in the background; the current scene keeps rendering
+        RequestScene(filename);
     }
     else
     {
@@ -289,203 +487,1559 @@ void Application::OnFileDropped(const std::string &filename, uint8_t *data, int
 
 void Application::MainLoop()
 {
+    auto nextFrameTime = std::chrono::steady_clock::now();
     while (!glfwWindowShouldClose(m_window) && !m_quitApp)
     {
-        glfwPollEvents();
+        // Sleep until input arrives when the last frame is still current
+        if (NeedsRedraw())
+        {
+            glfwPollEvents();
+        }
+        else
+        {
+            // During playback, wake up in time for the next animation frame
+            m_profiler.SkipIdleTime();
+            double timeout = IsBusy() ? kBusyWaitSeconds : kIdleWaitSeconds;
+            if (m_timeline.IsPlaying())
+            {
+                timeout = std::min(timeout, m_timeline.GetSecondsToNextFrame());
+            }
+            if (timeout > 0.0)
+            {
+                glfwWaitEventsTimeout(timeout);
+            }
+            else
+            {
+                glfwPollEvents();
+            }
+        }
+
+        UpdateSceneLoading();
+        UpdateStreaming();
+        UpdatePlayback();
+        UpdateLiveReload();
+        UpdateEnvironmentLoading();
+        if (m_frameCapture)
+        {
+            m_frameCapture->Update();
+        }
+
+        glm::vec2 click;
+        if (m_controls->TakeClick(click))
+        {
+            PickAt(click);
+        }
+
+        if (!NeedsRedraw())
+        {
+            continue;
+        }
+
+        // Frame cap; input that arrives meanwhile is still applied to this frame
+        if (m_options.maxFps > 0)
+        {
+            auto now = std::chrono::steady_clock::now();
+            while (now < nextFrameTime)
+            {
+                glfwWaitEventsTimeout(std::chrono::duration<double>(nextFrameTime - now).count());
+                now = std::chrono::steady_clock::now();
+            }
+            nextFrameTime = now + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                      std::chrono::duration<double>(1.0 / m_options.maxFps));
+        }
 
+        m_profiler.BeginFrame();
         ProcessFrame();
+        m_profiler.EndFrame();
 
-        m_fpsCounter.tick(m_window);
+        m_profiler.UpdateWindowTitle(m_window);
     }
 
-    // Destroy Hydra resources flush the GL pipeline
-    m_engine.reset();
-    m_hgiInterop.reset();
-    glFinish();
-
-    // Destroy the window and terminate GLFW
-    glfwDestroyWindow(m_window);
-    m_window = nullptr;
+    Shutdown();
 }
 
-void Application::ProcessFrame()
-{ 
-    // Update camera
-    pxr::GfMatrix4d viewMatrix = ToGfMatrix(m_camera.GetViewMatrix());
-    pxr::GfMatrix4d projMatrix = ToGfMatrix(m_camera.GetProjectionMatrix());
-    m_engine->SetCameraState(viewMatrix, projMatrix);
-
-    // Update viewport and render buffer size
-    glViewport(0, 0, m_framebufferWidth, m_framebufferHeight);
-    m_engine->SetRenderViewport(pxr::GfVec4d(0, 0, m_framebufferWidth, m_framebufferHeight));
-    m_engine->SetRenderBufferSize(pxr::GfVec2i(m_framebufferWidth, m_framebufferHeight));
-    m_engine->SetWindowPolicy(pxr::CameraUtilConformWindowPolicy::CameraUtilFit);
-    m_engine->SetRendererAov(pxr::HdAovTokens->color);
-
-    // Clear the screen
-    pxr::GfVec4f clearColor(0.09f, 0.24f, 0.43f, 1.0f);
-    glClearColor(clearColor[0], clearColor[1], clearColor[2], clearColor[3]);
-    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+bool Application::NeedsRedraw() const
+{
+    if (m_options.continuousRedraw || m_redrawRequested)
+    {
+        return true;
+    }
 
-    CHECK_GL_ERROR(__LINE__);
+    // Restore full resolution and render purpose once navigation stops
+    if ((m_resolution.GetScale() < 1.0f || m_showingProxy) && !m_controls->IsInteracting())
+    {
+        return true;
+    }
 
-    // Init render params
-    pxr::UsdImagingGLRenderParams renderParams{};
-    renderParams.cullStyle = pxr::UsdImagingGLCullStyle::CULL_STYLE_BACK_UNLESS_DOUBLE_SIDED;
-    renderParams.clearColor = clearColor;
-    renderParams.showProxy = false;
-    renderParams.showRender = true;
-    renderParams.gammaCorrectColors = false;
-    renderParams.colorCorrectionMode = pxr::HdxColorCorrectionTokens->sRGB;
+    // Progressive renderers keep refining the image until they converge
+    if (m_engine && !m_pendingScene && !m_engine->IsConverged())
+    {
+        return true;
+    }
 
-    // Render the scene
-    m_engine->Render(m_stage->GetPseudoRoot(), renderParams);
+    return m_camera.GetViewMatrix() != m_renderedViewMatrix ||
+           m_camera.GetProjectionMatrix() != m_renderedProjectionMatrix;
+}
 
-    // Get the color AOV texture and transfer it to OpenGL back buffer
-    pxr::HgiTextureHandle aovTexture = m_engine->GetAovTexture(pxr::HdAovTokens->color);
-    if (aovTexture)
+bool Application::UseProxyPurpose(bool cameraMoved) const
+{
+    if (!m_options.adaptiveLod || !m_sceneHasProxies)
     {
-        uint32_t framebuffer = 0;
-        m_hgiInterop->TransferToApp(m_engine->GetHgi(), aovTexture,
-                                    /*srcDepth*/ pxr::HgiTextureHandle(), pxr::HgiTokens->OpenGL,
-                                    pxr::VtValue(framebuffer),
-                                    pxr::GfVec4i(0, 0, m_framebufferWidth, m_framebufferHeight));
-        CHECK_GL_ERROR(__LINE__);
+        return false;
     }
-    else
+    if (m_controls->IsInteracting())
     {
-        std::cerr << "Failed to get AOV texture." << std::endl;
+        return true;
     }
 
-    // Swap front and back buffers
-    glfwSwapBuffers(m_window);
+    // Other camera motion (e.g. camera path playback) switches once frames go over budget, and stays on proxies
+    // until the camera stops so the cheaper frames don't flip it straight back
+    bool overBudget = m_options.frameBudgetMs > 0.0f && m_profiler.GetLastFrameCostMs() > m_options.frameBudgetMs;
+    return cameraMoved && (m_showingProxy || overBudget);
 }
 
-void Application::LoadScene(const std::string &filename)
+bool Application::IsBusy() const
+{
+    return m_pendingScene || m_sceneLoader.IsLoading() || (m_payloadStreamer && m_payloadStreamer->IsBusy()) ||
+           m_resolution.GetScale() < 1.0f || m_layerWatcher.HasPendingChanges() ||
+           m_environmentLoader.IsLoading() || (m_frameCapture && m_frameCapture->IsBusy());
+}
+
+bool Application::RunBenchmark()
 {
-    // Open the stage from disk
-    pxr::UsdStageRefPtr srcStage = pxr::UsdStage::Open(filename);
-    if (!srcStage)
+    if (!m_stage)
     {
-        std::cerr << "Failed to load stage: " << filename << std::endl;
-        return;
+        Shutdown();
+        return false;
+    }
+
+    // With --play, animated scenes advance one time code step per rendered frame
+    bool animate = m_options.play && m_timeline.HasAnimation();
+    m_timeline.Pause();
+
+    // Play back the recorded camera path, or orbit around the model if none was given
+    CameraPath path = CameraPath::CreateOrbit();
+    if (!m_options.cameraPathFile.empty() && !path.Load(m_options.cameraPathFile))
+    {
+        Shutdown();
+        return false;
     }
 
-    // Create an in‑memory stage
-    pxr::UsdStageRefPtr stage = pxr::UsdStage::CreateInMemory();
+    std::cout << "Benchmark: " << m_options.frameCount << " frames at " << m_framebufferWidth << "x"
+              << m_framebufferHeight << ", camera path with " << path.GetStepCount() << " steps" << std::endl;
+
+    m_profiler.SetHistorySize(m_options.frameCount);
+    m_profiler.Clear();
+    RenderBenchmarkFrames(path, m_options.frameCount, animate);
 
-    // Define a World root
-    pxr::UsdPrim world = stage->DefinePrim(pxr::SdfPath("/World"), pxr::TfToken("Scope"));
+    // Wait for the GPU timings of the last frames
+    m_profiler.Flush();
 
-    // Under the root, create the Model scope (Xform if needed)
-    pxr::UsdPrim modelPrim;
-    bool needsRot = (pxr::UsdGeomGetStageUpAxis(srcStage) == pxr::UsdGeomTokens->z);
-    if (needsRot)
+    std::vector<FrameTiming> timings = m_profiler.GetHistory();
+    PrintFrameTimingSummary(timings);
+    bool success = m_options.timingsFile.empty() || WriteFrameTimings(m_options.timingsFile, timings);
+    if (!m_options.traceFile.empty())
     {
-        modelPrim = stage->DefinePrim(pxr::SdfPath("/World/Model"), pxr::TfToken("Xform"));
-        pxr::UsdGeomXformable xf(modelPrim);
-        auto rot = xf.AddXformOp(pxr::UsdGeomXformOp::TypeRotateX);
-        rot.Set(-90.0, pxr::UsdTimeCode::Default());
+        success &= m_profiler.ExportChromeTrace(m_options.traceFile);
     }
-    else
+    if (!m_options.switchSceneFile.empty())
     {
-        modelPrim = stage->DefinePrim(pxr::SdfPath("/World/Model"), pxr::TfToken("Scope"));
+        success &= RunSceneSwitchBenchmark();
     }
 
-    // Reference the scene under /World/Model
-    modelPrim.GetReferences().AddReference(filename);
+    Shutdown();
+    return success;
+}
 
-    // Use the new stage
-    m_stage = stage;
+bool Application::RunSceneSwitchBenchmark()
+{
+    // Alternate between the two scenes; each switch renders one frame of the new scene from the home view
+    std::vector<double> latencies;
+    for (uint32_t i = 0; i < kSceneSwitchCount; ++i)
+    {
+        const std::string &filename = (i % 2 == 0) ? m_options.switchSceneFile : m_options.sceneFile;
+        LoadScene(filename);
+        if (!m_measuringSwitch)
+        {
+            std::cerr << "Scene switch benchmark: failed to load " << filename << std::endl;
+            return false;
+        }
 
-    // Reset camera position
-    glm::vec3 minBounds, maxBounds;
-    ComputeSceneBounds(m_stage, minBounds, maxBounds);
-    m_camera.ResetToModel(minBounds, maxBounds);
+        UpdateStreaming();
+        m_profiler.BeginFrame();
+        ProcessFrame();
+        m_profiler.EndFrame();
+        latencies.push_back(m_lastSwitchMs);
+    }
 
-    // Reset Hydra engine and HgiInterop
-    InitHydra();
+    double total = 0.0;
+    for (double latency : latencies)
+    {
+        total += latency;
+    }
+    std::cout << "Scene switch latency over " << latencies.size() << " switches: mean " << total / latencies.size()
+              << " ms, max " << *std::max_element(latencies.begin(), latencies.end()) << " ms" << std::endl;
+    return true;
 }
 
-void Application::InitHydra()
+bool Application::RunBatchBenchmark()
 {
-    // Initialize Engine and HgiInterop
-    m_engine.reset(new pxr::UsdImagingGLEngine());
-    m_hgiInterop.reset(new pxr::HgiInterop());
-
-    std::cout << "Renderer plugin: " << m_engine->GetCurrentRendererId() << std::endl;
-    std::cout << "Renderer HGI backend: " << m_engine->GetRendererHgiDisplayName() << std::endl;
+    BenchmarkManifest manifest;
+    std::vector<BenchmarkResult> baseline;
+    if (!LoadBenchmarkManifest(m_options.batchManifestFile, manifest) ||
+        (!m_options.baselineFile.empty() && !LoadBenchmarkResults(m_options.baselineFile, baseline)))
+    {
+        Shutdown();
+        return false;
+    }
 
-    // Setup lighting
-    if (m_domeLightTexture.empty())
+    std::vector<BenchmarkResult> results;
+    for (const BenchmarkCase &benchmarkCase : manifest.cases)
     {
-        SetupDefaultLighting();
+        if (!m_options.batchStage.empty() && benchmarkCase.name != m_options.batchStage)
+        {
+            continue;
+        }
+        std::cout << "Benchmark stage " << benchmarkCase.name << ": " << benchmarkCase.sceneFile << std::endl;
+        results.push_back(RunBenchmarkCase(benchmarkCase));
     }
-    else
+    if (results.empty())
     {
-        SetupDomeLight();
+        std::cerr << "Batch benchmark: no stage named " << m_options.batchStage << std::endl;
+        Shutdown();
+        return false;
     }
+
+    // A single stage replaces its own results and keeps those the other stages' runs wrote
+    std::vector<BenchmarkResult> written;
+    if (!m_options.batchStage.empty() && !m_options.batchResultsFile.empty() &&
+        std::filesystem::exists(m_options.batchResultsFile))
+    {
+        LoadBenchmarkResults(m_options.batchResultsFile, written);
+        auto sameStage = [&](const BenchmarkResult &result) { return result.name == m_options.batchStage; };
+        written.erase(std::remove_if(written.begin(), written.end(), sameStage), written.end());
+    }
+    written.insert(written.end(), results.begin(), results.end());
+
+    bool success = m_options.batchResultsFile.empty() || WriteBenchmarkResults(m_options.batchResultsFile, written);
+    success &= CompareBenchmarkResults(results, baseline, manifest.tolerances);
+
+    Shutdown();
+    return success;
 }
 
-void Application::SetupDefaultLighting()
+bool Application::RunScalingBenchmark()
 {
-    // Setup default lighting
+    // Thread counts to time: powers of two up to the cores (or --threads), and that limit itself
+    uint32_t maxThreads = m_options.threads > 0 ? m_options.threads : pxr::WorkGetPhysicalConcurrencyLimit();
+    std::vector<uint32_t> threadCounts;
+    for (uint32_t threads = 1; threads < maxThreads; threads *= 2)
+    {
+        threadCounts.push_back(threads);
+    }
+    threadCounts.push_back(maxThreads);
 
-    pxr::GlfSimpleLightVector lights;
+    // Loads the scene cold and renders its first frame; returns false if it failed to load
+    auto timeLoad = [this](double &loadMs, double &syncMs) {
+        UnloadScene();
+        LoadScene(m_options.sceneFile);
+        if (!m_measuringSwitch)
+        {
+            std::cerr << "Scaling benchmark: failed to load " << m_options.sceneFile << std::endl;
+            return false;
+        }
+        m_profiler.BeginFrame();
+        ProcessFrame();
+        m_profiler.EndFrame();
+        loadMs = m_switchLoadMs;
+        syncMs = m_lastSwitchMs - m_switchLoadMs;
+        return true;
+    };
 
-    // === Key Light:
+    // One untimed run first, so plugin loading and the driver's shader cache don't count against one thread
+    double loadMs = 0.0;
+    double syncMs = 0.0;
+    if (!timeLoad(loadMs, syncMs))
     {
-        pxr::GlfSimpleLight key;
-        key.SetPosition(pxr::GfVec4f(800.0f, 200.0f, 800.0f, 1.0f));
-
-        pxr::GfVec4f warmSRGB{1.0f,0.95f,0.9f,1.0f};
-        key.SetDiffuse(0.8f * ToLinear(warmSRGB));
-        key.SetAmbient(ToLinear({0.05f, 0.05f, 0.05f, 1.0f}));
-        key.SetSpecular(ToLinear({0.8f, 0.8f, 0.8f, 1.0f}));
-        key.SetSpotDirection(pxr::GfVec3f(0, 0, -1));
-        lights.push_back(key);
+        Shutdown();
+        return false;
     }
 
-    // === Fill Light:
+    // Load: opening and composing the layers. Sync: applying the scene, Hydra sync and the first frame's GPU work
+    std::vector<double> loadTimes;
+    std::vector<double> syncTimes;
+    unsigned threadLimit = pxr::WorkGetConcurrencyLimit();
+    for (uint32_t threads : threadCounts)
     {
-        pxr::GlfSimpleLight fill;
-        fill.SetPosition(pxr::GfVec4f(-600.0f, 100.0f, 900.0f, 1.0f));
-
-        fill.SetDiffuse(ToLinear({0.6f, 0.7f, 1.0f, 1.0f}));
-        fill.SetAmbient(ToLinear({0.05f, 0.05f, 0.05f, 1.0f}));
-        fill.SetSpecular(ToLinear({0.5f, 0.5f, 0.5f, 1.0f}));
-        fill.SetSpotDirection(pxr::GfVec3f(0, 0, -1));
-        lights.push_back(fill);
+        pxr::WorkSetConcurrencyLimit(threads);
+        double bestLoadMs = 0.0;
+        double bestSyncMs = 0.0;
+        for (uint32_t run = 0; run < kScalingRuns; ++run)
+        {
+            if (!timeLoad(loadMs, syncMs))
+            {
+                Shutdown();
+                return false;
+            }
+            bestLoadMs = run == 0 ? loadMs : std::min(bestLoadMs, loadMs);
+            bestSyncMs = run == 0 ? syncMs : std::min(bestSyncMs, syncMs);
+        }
+        loadTimes.push_back(bestLoadMs);
+        syncTimes.push_back(bestSyncMs);
     }
-
-    // === Back Light:
+    pxr::WorkSetConcurrencyLimit(threadLimit);
+
+    // Speedups are relative to one thread; efficiency is the total speedup per thread
+    std::printf("Scaling benchmark: %s, best of %u runs per thread count\n", m_options.sceneFile.c_str(),
+                kScalingRuns);
+    std::printf("%8s %10s %8s %10s %8s %10s %8s %10s\n", "threads", "load ms", "speedup", "sync ms", "speedup",
+                "total ms", "speedup", "efficiency");
+    double baseTotal = loadTimes[0] + syncTimes[0];
+    for (size_t i = 0; i < threadCounts.size(); ++i)
     {
-        pxr::GlfSimpleLight back;
-        back.SetPosition(pxr::GfVec4f(0.0f, 300.0f, -400.0f, 1.0f));
+        double total = loadTimes[i] + syncTimes[i];
+        double speedup = baseTotal / total;
+        std::printf("%8u %10.1f %7.2fx %10.1f %7.2fx %10.1f %7.2fx %9.0f%%\n", threadCounts[i], loadTimes[i],
+                    loadTimes[0] / loadTimes[i], syncTimes[i], syncTimes[0] / syncTimes[i], total, speedup,
+                    100.0 * speedup / threadCounts[i]);
+    }
+    std::fflush(stdout);
 
-        back.SetDiffuse(ToLinear({0.3f, 0.3f, 0.4f, 1.0f}));
-        back.SetAmbient(ToLinear({0.02f, 0.02f, 0.02f, 1.0f}));
-        back.SetSpecular(ToLinear({0.3f, 0.3f, 0.3f, 1.0f}));
-        back.SetSpotDirection(pxr::GfVec3f(0, 0, 1));
-        lights.push_back(back);
+    Shutdown();
+    return true;
+}
+
+bool Application::RunPresentBenchmark()
+{
+    LoadScene(m_options.sceneFile);
+    if (!m_measuringSwitch)
+    {
+        std::cerr << "Presentation benchmark: failed to load " << m_options.sceneFile << std::endl;
+        Shutdown();
+        return false;
     }
 
-    // Fallback material
-    pxr::GlfSimpleMaterial material;
-    material.SetAmbient(ToLinear({0.1f, 0.1f, 0.1f, 1.0f}));
-    material.SetSpecular(ToLinear({0.6f, 0.6f, 0.6f, 0.6f}));
-    material.SetShininess(16.0);
+    // Both paths render the same orbit at each size; only how the AOV reaches the framebuffer differs
+    CameraPath path = CameraPath::CreateOrbit();
+    m_profiler.SetHistorySize(kPresentFrames);
+    std::printf("Presentation benchmark: %s, p50 of %u frames per run\n", m_options.sceneFile.c_str(), kPresentFrames);
+    std::printf("%10s %8s %10s %10s %12s %10s\n", "size", "path", "frame ms", "gpu ms", "transfer ms", "MB/frame");
+    for (const int *size : kPresentSizes)
+    {
+        SetHeadlessSize(size[0], size[1]);
 
-    // Ambient light
-    pxr::GfVec4f sceneAmbient = ToLinear({0.1f, 0.1f, 0.1f, 1.0f});
+        double frameMs[2] = {};
+        double gpuMs[2] = {};
+        double megabytes[2] = {};
+        for (bool direct : {false, true})
+        {
+            SetDirectPresent(direct);
+            RenderBenchmarkFrames(path, kPresentWarmup, false);
+            m_profiler.Clear();
+            RenderBenchmarkFrames(path, kPresentFrames, false);
+            m_profiler.Flush();
+
+            std::vector<double> frameTimes, gpuTimes, transferTimes;
+            for (const FrameTiming &timing : m_profiler.GetHistory())
+            {
+                frameTimes.push_back(timing.frameMs);
+                gpuTimes.push_back(timing.gpuMs);
+                transferTimes.push_back(timing.gpuPhaseMs[static_cast<size_t>(FramePhase::Transfer)]);
+            }
+
+            // The AOV's format decides its share of the traffic (RGBA16F in Storm); the targets are RGBA8
+            double aovBytes = 0.0;
+            if (pxr::HgiTextureHandle aovTexture = m_engine->GetAovTexture(pxr::HdAovTokens->color))
+            {
+                const pxr::HgiTextureDesc &desc = aovTexture->GetDescriptor();
+                aovBytes = static_cast<double>(desc.dimensions[0]) * desc.dimensions[1] *
+                           pxr::HgiGetDataSizeOfFormat(desc.format);
+            }
+            double framebufferBytes = 4.0 * size[0] * size[1];
+
+            frameMs[direct] = Percentile(frameTimes, 50.0);
+            gpuMs[direct] = Percentile(gpuTimes, 50.0);
+            megabytes[direct] = EstimatePresentBytes(direct, aovBytes, framebufferBytes) / (1024.0 * 1024.0);
+            std::printf("%5dx%-4d %8s %10.2f %10.2f %12.2f %10.1f\n", size[0], size[1], direct ? "direct" : "interop",
+                        frameMs[direct], gpuMs[direct], Percentile(transferTimes, 50.0), megabytes[direct]);
+        }
+        std::printf("%10s %8s %10.2f %10.2f %12s %10.1f\n", "", "saved", frameMs[0] - frameMs[1], gpuMs[0] - gpuMs[1],
+                    "", megabytes[0] - megabytes[1]);
+    }
+    std::fflush(stdout);
 
-    // Update renderer
-    m_engine->SetLightingState(lights, material, sceneAmbient);
+    Shutdown();
+    return true;
 }
 
-void Application::SetupDomeLight()
+bool Application::RunTurntableCapture()
 {
-    // Setup dome light
-    pxr::UsdLuxDomeLight domeLight = pxr::UsdLuxDomeLight::Define(m_stage, pxr::SdfPath("/World/DomeLight"));
-    domeLight.CreateTextureFileAttr().Set(pxr::SdfAssetPath(m_domeLightTexture));
-}
\ No newline at end of file
+    std::error_code error;
+    std::filesystem::create_directories(m_options.captureDir, error);
+    if (!m_stage || error)
+    {
+        if (error)
+        {
+            std::cerr << "Capture: cannot create " << m_options.captureDir << std::endl;
+        }
+        Shutdown();
+        return false;
+    }
+    if (m_options.captureWidth > 0)
+    {
+        SetHeadlessSize(m_options.captureWidth, m_options.captureHeight);
+    }
+
+    // Orbit from the home view through Camera::Tumble; with --play, animated scenes advance one frame per image
+    CameraPath path = CameraPath::CreateOrbit();
+    uint32_t frameCount = m_options.captureFrames > 0 ? m_options.captureFrames
+                                                      : static_cast<uint32_t>(CameraPath::kOrbitTurnSteps);
+    bool animate = m_options.play && m_timeline.HasAnimation();
+    m_timeline.Pause();
+    m_frameCapture = std::make_unique<FrameCapture>();
+
+    std::cout << "Capturing " << frameCount << " frames at " << m_framebufferWidth << "x" << m_framebufferHeight
+              << " to " << m_options.captureDir << std::endl;
+    m_profiler.SetHistorySize(frameCount);
+    m_profiler.Clear();
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t frame = 0; frame < frameCount; ++frame)
+    {
+        // Rendering runs ahead of the readbacks and encoders by the ring size; any waiting happens between frames
+        m_frameCapture->WaitForSlot();
+
+        path.Apply(frame, m_camera);
+        if (animate)
+        {
+            m_timeline.SetFrame(frame);
+            UpdatePlayback();
+        }
+        char name[32];
+        std::snprintf(name, sizeof(name), "frame_%04u.%s", frame, m_options.captureFormat.c_str());
+        m_captureFile = (std::filesystem::path(m_options.captureDir) / name).string();
+
+        m_profiler.BeginFrame();
+        ProcessFrame();
+        m_profiler.EndFrame();
+        m_frameCapture->Update();
+    }
+    m_captureFile.clear();
+    m_frameCapture->Finish();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    m_profiler.Flush();
+    PrintFrameTimingSummary(m_profiler.GetHistory());
+    size_t written = m_frameCapture->GetWrittenCount();
+    std::printf("Captured %zu of %u frames in %.2f s: %.1f frames/s written to disk\n", written, frameCount, seconds,
+                written / seconds);
+    std::fflush(stdout);
+
+    Shutdown();
+    return written == frameCount;
+}
+
+BenchmarkResult Application::RunBenchmarkCase(const BenchmarkCase &benchmarkCase)
+{
+    BenchmarkResult result;
+    result.name = benchmarkCase.name;
+
+    CameraPath path = CameraPath::CreateOrbit();
+    if (!benchmarkCase.cameraPathFile.empty() && !path.Load(benchmarkCase.cameraPathFile))
+    {
+        return result;
+    }
+
+    UnloadScene();
+    m_options.sceneSource = benchmarkCase.source;
+    m_options.autoInstance = benchmarkCase.autoInstance;
+
+    // Recreated even when the latency is unchanged, so every stage starts with an idle GPU, no fences left from
+    // the last stage and new offscreen targets
+    m_options.frameLatency = benchmarkCase.frameLatency;
+    SetFrameLatency(m_options.frameLatency);
+    SetDirectPresent(benchmarkCase.directPresent);
+
+    // One untimed load and frame first, as in the scaling benchmark, so plugin loading and shader compilation
+    // count against no stage, whichever runs first
+    LoadScene(benchmarkCase.sceneFile);
+    if (m_measuringSwitch)
+    {
+        m_profiler.BeginFrame();
+        ProcessFrame();
+        m_profiler.EndFrame();
+    }
+
+    // Then start cold: without the stage, engine and scene cache, the load opens every layer again and the first
+    // frame syncs everything. Stages share the process, so the peak only covers this stage where the OS can reset it.
+    UnloadScene();
+    ResetPeakRss();
+    LoadScene(benchmarkCase.sceneFile);
+    if (!m_measuringSwitch)
+    {
+        std::cerr << "Batch benchmark: failed to load " << benchmarkCase.sceneFile << std::endl;
+        return result;
+    }
+
+    // The first frame from the home view completes the load
+    UpdateStreaming();
+    m_profiler.BeginFrame();
+    ProcessFrame();
+    m_profiler.EndFrame();
+    result.loadMs = m_switchLoadMs + m_switchApplyMs;
+    result.firstFrameMs = m_lastSwitchMs;
+
+    // Steady state: warm up, then time the frames along the camera path
+    bool animate = benchmarkCase.play && m_timeline.HasAnimation();
+    m_timeline.Pause();
+    RenderBenchmarkFrames(path, benchmarkCase.warmupFrames, animate);
+    m_profiler.SetHistorySize(benchmarkCase.frameCount);
+    m_profiler.Clear();
+    RenderBenchmarkFrames(path, benchmarkCase.frameCount, animate);
+    m_profiler.Flush();
+
+    std::vector<double> frameTimes;
+    for (const FrameTiming &timing : m_profiler.GetHistory())
+    {
+        frameTimes.push_back(timing.frameMs);
+    }
+    result.frameMsP50 = Percentile(frameTimes, 50.0);
+    result.frameMsP95 = Percentile(frameTimes, 95.0);
+    result.peakRssMB = GetPeakRssBytes() / (1024.0 * 1024.0);
+    result.loaded = true;
+    return result;
+}
+
+void Application::RenderBenchmarkFrames(const CameraPath &path, uint32_t frameCount, bool animate)
+{
+    for (uint32_t frame = 0; frame < frameCount; ++frame)
+    {
+        path.Apply(frame, m_camera);
+        if (animate)
+        {
+            m_timeline.SetFrame(frame);
+            UpdatePlayback();
+        }
+        UpdateStreaming();
+
+        m_profiler.BeginFrame();
+        ProcessFrame();
+        m_profiler.EndFrame();
+    }
+}
+
+void Application::Shutdown()
+{
+    // Destroy Hydra resources flush the GL pipeline (captured images still queued are written first)
+    pxr::TfNotice::Revoke(m_stageChangedKey);
+    m_frameCapture.reset();
+    m_pageWarmer.reset();
+    m_payloadStreamer.reset();
+    m_engine.reset();
+    m_hgiInterop.reset();
+    m_hgi.reset();
+    m_profiler.ReleaseGpuTiming();
+    m_boundsOverlay.reset();
+    m_framePacer.reset();
+    DestroyOffscreenFramebuffer();
+    glDeleteFramebuffers(1, &m_aovFramebuffer);
+    m_aovFramebuffer = 0;
+    glFinish();
+
+    // Destroy the window and terminate GLFW
+    glfwDestroyWindow(m_window);
+    m_window = nullptr;
+}
+
+void Application::ProcessFrame()
+{
+    // Wait until the GPU is at most --frame-latency frames behind; Hydra then syncs this frame while the GPU
+    // still draws the previous ones
+    if (m_framePacer)
+    {
+        FrameProfiler::Scope scope(m_profiler, FramePhase::Wait);
+        size_t slot = m_framePacer->BeginFrame();
+        if (!m_offscreenTargets.empty())
+        {
+            m_offscreenFramebuffer = m_offscreenTargets[slot % m_offscreenTargets.size()].framebuffer;
+        }
+    }
+
+    // Choose the purpose to draw before the camera state is recorded below
+    bool cameraMoved = m_camera.GetViewMatrix() != m_renderedViewMatrix ||
+                       m_camera.GetProjectionMatrix() != m_renderedProjectionMatrix;
+    m_showingProxy = UseProxyPurpose(cameraMoved);
+
+    // Remember what this frame shows; NeedsRedraw() compares against it
+    m_redrawRequested = false;
+    m_renderedViewMatrix = m_camera.GetViewMatrix();
+    m_renderedProjectionMatrix = m_camera.GetProjectionMatrix();
+
+    // Until the first scene is ready, or while a new one is swapped in, draw only its placeholder bounds
+    if (!m_engine || m_pendingScene)
+    {
+        glBindFramebuffer(GL_FRAMEBUFFER, m_offscreenFramebuffer);
+        glViewport(0, 0, m_framebufferWidth, m_framebufferHeight);
+        glClearColor(kClearColor[0], kClearColor[1], kClearColor[2], kClearColor[3]);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        DrawPlaceholders();
+        PresentFrame();
+        return;
+    }
+
+    // If an edit or reload removed the isolated prim, everything else is still excluded; render everything.
+    // Resyncs may also have added siblings of the isolated subtree, which the engine has to exclude as well.
+    if (!m_stage->GetPrimAtPath(m_renderRoot))
+    {
+        SetIsolation(pxr::SdfPath::AbsoluteRootPath(), m_excludedPaths);
+    }
+    else if (m_isolationStale)
+    {
+        SetIsolation(m_renderRoot, m_excludedPaths);
+    }
+    m_isolationStale = false;
+
+    {
+        FrameProfiler::Scope scope(m_profiler, FramePhase::SetCamera);
+
+        // Update camera
+        pxr::GfMatrix4d viewMatrix = ToGfMatrix(m_camera.GetViewMatrix());
+        pxr::GfMatrix4d projMatrix = ToGfMatrix(m_camera.GetProjectionMatrix());
+        m_engine->SetCameraState(viewMatrix, projMatrix);
+
+        // Render at reduced resolution while navigating; the transfer below scales the AOV to the framebuffer
+        float scale = m_resolution.Update(m_controls->IsInteracting(), m_profiler.GetLastFrameCostMs());
+        int renderWidth = std::max(1, static_cast<int>(m_framebufferWidth * scale + 0.5f));
+        int renderHeight = std::max(1, static_cast<int>(m_framebufferHeight * scale + 0.5f));
+
+        // Update viewport and render buffer size
+        glViewport(0, 0, m_framebufferWidth, m_framebufferHeight);
+        m_engine->SetRenderViewport(pxr::GfVec4d(0, 0, renderWidth, renderHeight));
+        m_engine->SetRenderBufferSize(pxr::GfVec2i(renderWidth, renderHeight));
+        m_engine->SetWindowPolicy(pxr::CameraUtilConformWindowPolicy::CameraUtilFit);
+        m_engine->SetRendererAov(pxr::HdAovTokens->color);
+    }
+
+    // Clear the screen (the direct blit overwrites every pixel, so it only needs depth for the placeholders)
+    glBindFramebuffer(GL_FRAMEBUFFER, m_offscreenFramebuffer);
+    glClearColor(kClearColor[0], kClearColor[1], kClearColor[2], kClearColor[3]);
+    glClear(m_options.directPresent ? GL_DEPTH_BUFFER_BIT : GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+    CHECK_GL_ERROR(__LINE__);
+
+    // Init render params
+    pxr::UsdImagingGLRenderParams renderParams{};
+    renderParams.cullStyle = pxr::UsdImagingGLCullStyle::CULL_STYLE_BACK_UNLESS_DOUBLE_SIDED;
+    renderParams.clearColor = kClearColor;
+    // Purposes only select render tags, so switching doesn't resync prims; each purpose syncs once when first shown
+    renderParams.showProxy = m_showingProxy;
+    renderParams.showRender = !m_showingProxy;
+    renderParams.gammaCorrectColors = false;
+    renderParams.colorCorrectionMode = pxr::HdxColorCorrectionTokens->sRGB;
+    renderParams.frame = m_timeline.GetTime();
+
+    // Render the scene
+    {
+        FrameProfiler::Scope scope(m_profiler, FramePhase::Render);
+        LoadPhaseScope loadPhase(m_measuringSwitch ? m_loadProfiler.GetPhases() : nullptr, "First Render");
+        if (m_renderArena)
+        {
+            // execute() runs on this thread, so the GL context stays current; only Hydra's workers are limited
+            m_renderArena->execute([&] { m_engine->Render(m_stage->GetPseudoRoot(), renderParams); });
+        }
+        else
+        {
+            m_engine->Render(m_stage->GetPseudoRoot(), renderParams);
+        }
+    }
+
+    // Get the color AOV texture and transfer it to OpenGL back buffer
+    pxr::HgiTextureHandle aovTexture = m_engine->GetAovTexture(pxr::HdAovTokens->color);
+    if (aovTexture)
+    {
+        FrameProfiler::Scope scope(m_profiler, FramePhase::Transfer);
+        if (m_options.directPresent)
+        {
+            BlitAovTexture(aovTexture);
+        }
+        else
+        {
+            uint32_t framebuffer = m_offscreenFramebuffer;
+            m_hgiInterop->TransferToApp(m_engine->GetHgi(), aovTexture,
+                                        /*srcDepth*/ pxr::HgiTextureHandle(), pxr::HgiTokens->OpenGL,
+                                        pxr::VtValue(framebuffer),
+                                        pxr::GfVec4i(0, 0, m_framebufferWidth, m_framebufferHeight));
+        }
+        CHECK_GL_ERROR(__LINE__);
+    }
+    else
+    {
+        std::cerr << "Failed to get AOV texture." << std::endl;
+    }
+
+    // Screenshots and turntable frames: the readback is only queued here and finishes frames later. Frames
+    // rendered at reduced resolution while navigating are skipped, as is everything while the ring is full.
+    if (!m_captureFile.empty() && aovTexture && m_frameCapture)
+    {
+        const pxr::GfVec3i &size = aovTexture->GetDescriptor().dimensions;
+        bool fullResolution = size[0] == static_cast<int>(m_framebufferWidth) &&
+                              size[1] == static_cast<int>(m_framebufferHeight);
+        if (fullResolution && m_frameCapture->Capture(static_cast<uint32_t>(aovTexture->GetRawResource()), size[0],
+                                                      size[1], m_captureFile))
+        {
+            m_captureFile.clear();
+        }
+        else
+        {
+            m_redrawRequested = true;
+        }
+    }
+
+    // Bounds of payloads that are streaming in
+    glBindFramebuffer(GL_FRAMEBUFFER, m_offscreenFramebuffer);
+    DrawPlaceholders();
+
+    PresentFrame();
+
+    if (m_measuringSwitch)
+    {
+        ReportSceneSwitch();
+    }
+}
+
+void Application::DrawPlaceholders()
+{
+    if (!m_boundsOverlay->IsEmpty())
+    {
+        m_boundsOverlay->Draw(m_camera.GetProjectionMatrix() * m_camera.GetViewMatrix(), kPlaceholderColor);
+    }
+}
+
+void Application::BlitAovTexture(const pxr::HgiTextureHandle &texture)
+{
+    // The AOV holds the cleared, color-corrected image, so there is nothing to blend: one blit copies it to the
+    // framebuffer and scales it up when rendering at reduced resolution
+    if (!m_aovFramebuffer)
+    {
+        glGenFramebuffers(1, &m_aovFramebuffer);
+    }
+    const pxr::GfVec3i &size = texture->GetDescriptor().dimensions;
+    bool scaled = size[0] != static_cast<int>(m_framebufferWidth) || size[1] != static_cast<int>(m_framebufferHeight);
+
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, m_aovFramebuffer);
+    glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D,
+                           static_cast<GLuint>(texture->GetRawResource()), 0);
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, m_offscreenFramebuffer);
+    glBlitFramebuffer(0, 0, size[0], size[1], 0, 0, m_framebufferWidth, m_framebufferHeight, GL_COLOR_BUFFER_BIT,
+                      scaled ? GL_LINEAR : GL_NEAREST);
+
+    // Detached again, so the engine can free or reallocate the AOV (e.g. on resize)
+    glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, 0, 0);
+    glBindFramebuffer(GL_FRAMEBUFFER, m_offscreenFramebuffer);
+}
+
+void Application::PresentFrame()
+{
+    // Swap front and back buffers (headless frames stay offscreen; just submit the work)
+    FrameProfiler::Scope scope(m_profiler, FramePhase::Present);
+    if (m_options.headless)
+    {
+        glFlush();
+    }
+    else
+    {
+        glfwSwapBuffers(m_window);
+    }
+    if (m_framePacer)
+    {
+        m_framePacer->EndFrame();
+    }
+}
+
+std::string Application::GetSceneSource(const std::string &filename) const
+{
+    if (IsMemoryAssetPath(filename))
+    {
+        return filename;
+    }
+
+    switch (m_options.sceneSource)
+    {
+    case SceneSource::Buffer: {
+        // Stands in for bytes that are already in memory, so reading the file is not part of the load time
+        size_t size = 0;
+        std::shared_ptr<const char> buffer = ReadFileBuffer(filename, size);
+        return buffer ? RegisterMemoryAsset(filename, std::move(buffer), size) : filename;
+    }
+    case SceneSource::MappedFile: {
+        std::string uri = RegisterMappedFile(filename);
+        return uri.empty() ? filename : uri;
+    }
+    case SceneSource::File:
+        break;
+    }
+    return filename;
+}
+
+pxr::UsdStagePopulationMask Application::GetPopulationMask() const
+{
+    if (m_options.populationMask.empty())
+    {
+        return pxr::UsdStagePopulationMask::All();
+    }
+
+    // Paths in the scene's namespace; the loader maps them onto the viewer's stage
+    pxr::UsdStagePopulationMask mask;
+    for (const std::string &path : m_options.populationMask)
+    {
+        if (!pxr::SdfPath::IsValidPathString(path) || !pxr::SdfPath(path).IsAbsoluteRootOrPrimPath())
+        {
+            std::cerr << "Ignoring invalid mask path: " << path << std::endl;
+            continue;
+        }
+        mask.Add(pxr::SdfPath(path));
+    }
+    return mask.IsEmpty() ? pxr::UsdStagePopulationMask::All() : mask;
+}
+
+SceneRequest Application::GetSceneRequest(const std::string &source) const
+{
+    SceneRequest request;
+    request.filename = source;
+    request.loadSet = GetInitialLoadSet();
+    request.mask = GetPopulationMask();
+    request.autoInstance = m_options.autoInstance;
+    return request;
+}
+
+pxr::SdfPath Application::ToModelPath(const std::string &path) const
+{
+    if (!pxr::SdfPath::IsValidPathString(path) || !pxr::SdfPath(path).IsAbsoluteRootOrPrimPath())
+    {
+        std::cerr << "Ignoring invalid prim path: " << path << std::endl;
+        return pxr::SdfPath();
+    }
+
+    pxr::SdfPath modelPath = MapToModelPath(pxr::SdfPath(path), m_defaultPrimPath);
+    if (modelPath.IsEmpty())
+    {
+        std::cerr << "Ignoring " << path << ", which is not under the default prim " << m_defaultPrimPath
+                  << std::endl;
+    }
+    return modelPath;
+}
+
+void Application::RequestScene(const std::string &filename)
+{
+    std::string source = GetSceneSource(filename);
+    m_scenePath = filename;
+    m_switchRequested = std::chrono::steady_clock::now();
+    m_loadProfiler.Begin(source);
+    AnimationPageWarmer::PauseScope pause(m_pageWarmer.get()); // Changed cached layers are reloaded in place
+    m_sceneLoader.Request(GetSceneRequest(source));
+}
+
+void Application::LoadScene(const std::string &filename)
+{
+    // Synchronous load, for headless runs
+    std::string source = GetSceneSource(filename);
+    m_scenePath = filename;
+    m_switchRequested = std::chrono::steady_clock::now();
+    m_loadProfiler.Begin(source);
+    LoadedScene scene;
+    {
+        AnimationPageWarmer::PauseScope pause(m_pageWarmer.get()); // Changed cached layers are reloaded in place
+        scene = m_sceneLoader.Load(GetSceneRequest(source));
+    }
+    ApplyScene(std::move(scene));
+}
+
+void Application::ApplyScene(LoadedScene scene)
+{
+    if (scene.layers.empty())
+    {
+        return;
+    }
+
+    auto applyStart = std::chrono::steady_clock::now();
+    m_loadProfiler.AddPhases(scene.phases);
+
+    // The streamer and page warmer track the old scene, and neither may touch the stage while it changes
+    m_payloadStreamer.reset();
+    m_pageWarmer.reset();
+
+    // Take over the stage the loader composed, so nothing is composed on this thread. An engine populates a
+    // single stage, so the old one goes too; the next is built on the same Hgi below. The old stage is freed on
+    // the loader thread.
+    {
+        LoadPhaseScope phase(m_loadProfiler.GetPhases(), "Apply Scene");
+        pxr::TfNotice::Revoke(m_stageChangedKey);
+        if (m_engine)
+        {
+            glFinish();
+            m_engine.reset();
+        }
+        m_sceneLoader.Release(std::move(m_stage));
+
+        m_stage = std::move(scene.stage);
+        m_stageChangedKey = pxr::TfNotice::Register(pxr::TfCreateWeakPtr(this), &Application::OnStageChanged,
+                                                    pxr::UsdStagePtr(m_stage));
+        m_boundsCache = std::make_unique<BoundsCache>(m_stage);
+
+        // The old scene's layers still hold its buffer, if it had one, until they are released
+        UnregisterMemoryAsset(m_sceneFile);
+        m_sceneFile = scene.filename;
+        m_watchedLayersChanged = true;
+    }
+
+    // Copied, so edits to this stage don't reach the hierarchy kept in the scene cache
+    m_sceneBvh = scene.bvh ? std::make_unique<SceneBvh>(*scene.bvh) : nullptr;
+    m_selectedPath = pxr::SdfPath();
+
+    // Isolation from the command line, in the new scene's namespace
+    m_defaultPrimPath = scene.defaultPrimPath;
+    pxr::SdfPath renderRoot = m_options.isolatePath.empty() ? pxr::SdfPath() : ToModelPath(m_options.isolatePath);
+    pxr::SdfPathVector excludedPaths;
+    for (const std::string &path : m_options.excludedPaths)
+    {
+        pxr::SdfPath excludedPath = ToModelPath(path);
+        if (!excludedPath.IsEmpty())
+        {
+            excludedPaths.push_back(excludedPath);
+        }
+    }
+    SetIsolation(renderRoot.IsEmpty() ? pxr::SdfPath::AbsoluteRootPath() : renderRoot, excludedPaths);
+
+    // Follow the new scene's time range, and keep playing if the last scene was
+    bool wasPlaying = m_timeline.IsPlaying();
+    m_timeline.Reset(m_stage);
+    if (m_timeline.HasAnimation())
+    {
+        if (m_options.prefetchFrames > 0)
+        {
+            m_pageWarmer = std::make_unique<AnimationPageWarmer>(m_stage, m_options.prefetchFrames);
+        }
+        if (m_options.play || wasPlaying)
+        {
+            m_timeline.Play();
+        }
+    }
+
+    // Reset camera position
+    m_camera.ResetToModel(scene.minBounds, scene.maxBounds);
+    m_sceneHasProxies = scene.hasProxies;
+
+    // Create the Hydra engine for the new stage (and the Hgi and HgiInterop for the first scene)
+    {
+        LoadPhaseScope phase(m_loadProfiler.GetPhases(), "Init Hydra");
+        InitHydra();
+    }
+
+    // Payloads were left unloaded; stream them in based on what the camera sees
+    if (m_options.streamPayloads)
+    {
+        PayloadStreamer::Settings settings;
+        settings.budgetBytes = size_t(m_options.streamBudgetMB) << 20;
+        settings.minScreenSize = m_options.streamMinScreenSize;
+        m_payloadStreamer = std::make_unique<PayloadStreamer>(m_stage, settings);
+    }
+
+    std::cout << "Loaded " << scene.filename << " in " << scene.loadSeconds << " s" << std::endl;
+    PrintSceneStats(scene.stats);
+    if (m_options.autoInstance)
+    {
+        PrintInstanceCandidates(scene.instanceCandidates);
+    }
+    if (!m_options.sceneStatsFile.empty())
+    {
+        WriteSceneStats(m_options.sceneStatsFile, scene.stats);
+    }
+
+    // Time the switch through to the first frame Hydra renders of the new scene
+    m_switchApplied = std::chrono::steady_clock::now();
+    m_switchLoadMs = scene.loadSeconds * 1000.0;
+    m_switchApplyMs = ElapsedMs(applyStart, m_switchApplied);
+    m_measuringSwitch = true;
+}
+
+void Application::UnloadScene()
+{
+    // Drop the stage and the Hydra engine too, so the next load composes and syncs everything from scratch (the
+    // Hgi and HgiInterop stay for the next engine)
+    pxr::TfNotice::Revoke(m_stageChangedKey);
+    m_pageWarmer.reset();
+    m_payloadStreamer.reset();
+    m_engine.reset();
+    m_stage = nullptr;
+    m_sceneBvh.reset();
+    m_boundsCache.reset();
+    m_selectedPath = pxr::SdfPath();
+    m_sceneLoader.ClearCache();
+    UnregisterMemoryAsset(m_sceneFile);
+    m_sceneFile.clear();
+    m_scenePath.clear();
+    m_layerWatcher.SetFiles({});
+    m_boundsOverlay->Clear();
+    glFinish();
+}
+
+void Application::PickAt(const glm::vec2 &position)
+{
+    if (!m_sceneBvh || !m_engine || m_pendingScene)
+    {
+        return;
+    }
+
+    // Unproject the cursor onto the near and far planes
+    glm::vec2 ndc(2.0f * position.x / m_windowWidth - 1.0f, 1.0f - 2.0f * position.y / m_windowHeight);
+    glm::mat4 inverseViewProjection = glm::inverse(m_camera.GetProjectionMatrix() * m_camera.GetViewMatrix());
+    glm::vec4 nearPoint = inverseViewProjection * glm::vec4(ndc, -1.0f, 1.0f);
+    glm::vec4 farPoint = inverseViewProjection * glm::vec4(ndc, 1.0f, 1.0f);
+    glm::vec3 origin = glm::vec3(nearPoint) / nearPoint.w;
+    glm::vec3 direction = glm::normalize(glm::vec3(farPoint) / farPoint.w - origin);
+
+    auto start = std::chrono::steady_clock::now();
+    pxr::SdfPath path;
+    bool hit = m_sceneBvh->Pick(m_stage, m_timeline.GetTime(), origin, direction, path);
+    double pickMs = ElapsedMs(start, std::chrono::steady_clock::now());
+
+    // Prims that aren't rendered can't be picked
+    hit = hit && path.HasPrefix(m_renderRoot) &&
+          std::none_of(m_excludedPaths.begin(), m_excludedPaths.end(),
+                       [&](const pxr::SdfPath &excluded) { return path.HasPrefix(excluded); });
+
+    // Clicking empty space clears the selection
+    m_selectedPath = hit ? path : pxr::SdfPath();
+    if (hit)
+    {
+        m_engine->SetSelected({path});
+        std::cout << "Selected " << path << " (picked in " << pickMs << " ms)" << std::endl;
+    }
+    else
+    {
+        m_engine->ClearSelected();
+    }
+    m_redrawRequested = true;
+}
+
+void Application::FrameSelection()
+{
+    // Without a selection, frame the whole scene, or what is isolated
+    pxr::SdfPath path = m_selectedPath.IsEmpty() ? m_renderRoot : m_selectedPath;
+    glm::vec3 minBounds, maxBounds;
+    if (m_sceneBvh && m_sceneBvh->GetBounds(m_stage, m_timeline.GetTime(), path, minBounds, maxBounds))
+    {
+        m_camera.ResetToModel(minBounds, maxBounds);
+    }
+}
+
+void Application::SetIsolation(const pxr::SdfPath &renderRoot, const pxr::SdfPathVector &excludedPaths)
+{
+    pxr::SdfPath root = renderRoot;
+    if (m_stage && !m_stage->GetPrimAtPath(root))
+    {
+        std::cerr << "Cannot isolate " << root << ", which is not on the stage" << std::endl;
+        root = pxr::SdfPath::AbsoluteRootPath();
+    }
+    bool changed = root != m_renderRoot || excludedPaths != m_excludedPaths;
+    m_renderRoot = root;
+    m_excludedPaths = excludedPaths;
+
+    // The engine also excludes the siblings of the render root's ancestors, which another scene or a resync can
+    // change while the root stays the same. It reads its excluded paths once, so any difference takes a new engine.
+    // The stage is untouched, and the program cache and the driver's shader cache keep the rebuild to the sync of
+    // what is shown.
+    if (m_engine && GetEngineExcludedPaths() != m_engineExcludedPaths)
+    {
+        glFinish();
+        m_engine.reset();
+        InitHydra();
+        if (!m_selectedPath.IsEmpty())
+        {
+            m_engine->SetSelected({m_selectedPath});
+        }
+        changed = true;
+    }
+    if (!changed)
+    {
+        return;
+    }
+    std::cout << "Rendering " << m_renderRoot << " (" << m_excludedPaths.size() << " paths hidden)" << std::endl;
+    m_redrawRequested = true;
+}
+
+pxr::SdfPathVector Application::GetEngineExcludedPaths() const
+{
+    // The engine stays rooted at the pseudo-root, so the viewer's dome light is still populated; isolation
+    // excludes the siblings of the render root and of each of its ancestors instead
+    pxr::SdfPathVector excludedPaths = m_excludedPaths;
+    if (!m_stage)
+    {
+        return excludedPaths;
+    }
+    for (pxr::SdfPath path = m_renderRoot; !path.IsAbsoluteRootPath(); path = path.GetParentPath())
+    {
+        pxr::UsdPrim parent = m_stage->GetPrimAtPath(path.GetParentPath());
+        if (!parent)
+        {
+            continue;
+        }
+        for (const pxr::UsdPrim &sibling : parent.GetAllChildren())
+        {
+            if (sibling.GetPath() != path && sibling.GetPath() != kDomeLightPath)
+            {
+                excludedPaths.push_back(sibling.GetPath());
+            }
+        }
+    }
+    return excludedPaths;
+}
+
+void Application::SetPopulationMask(const std::vector<std::string> &paths)
+{
+    // Scenes dropped as buffers are unregistered once replaced, so only files can be reloaded with a new mask
+    if (m_scenePath.empty() || IsMemoryAssetPath(m_scenePath))
+    {
+        std::cerr << "Cannot reload this scene with a new mask" << std::endl;
+        return;
+    }
+
+    m_options.populationMask = paths;
+    std::cout << "Reloading " << m_scenePath << (paths.empty() ? " unmasked" : " masked to " + paths.front())
+              << std::endl;
+    RequestScene(m_scenePath);
+}
+
+void Application::PrintOutline()
+{
+    if (m_sceneFile.empty())
+    {
+        return;
+    }
+
+    // Lists the children of the selection, or of the default prim, including those the mask leaves out
+    PrimOutline outline(m_sceneFile);
+    if (!outline.IsValid())
+    {
+        return;
+    }
+    pxr::SdfPath path = m_defaultPrimPath.IsEmpty() ? pxr::SdfPath::AbsoluteRootPath() : m_defaultPrimPath;
+    if (!m_selectedPath.IsEmpty() && m_selectedPath.HasPrefix(kModelPath) && !m_defaultPrimPath.IsEmpty())
+    {
+        path = m_selectedPath.ReplacePrefix(kModelPath, m_defaultPrimPath);
+    }
+    outline.Print(path, 1);
+}
+
+void Application::UpdateSceneLoading()
+{
+    // A request made while the loader was busy starts once its changed cached layers are reloaded
+    if (m_sceneLoader.IsRefreshDue())
+    {
+        AnimationPageWarmer::PauseScope pause(m_pageWarmer.get());
+        m_sceneLoader.RefreshDeferred();
+    }
+
+    // The placeholders have been on screen for a frame; now let Hydra populate the new scene
+    if (m_pendingScene)
+    {
+        ApplyScene(std::move(*m_pendingScene));
+        m_pendingScene.reset();
+        m_boundsOverlay->Clear();
+        m_redrawRequested = true;
+        return;
+    }
+
+    LoadedScene scene;
+    if (m_sceneLoader.Poll(scene))
+    {
+        m_camera.ResetToModel(scene.minBounds, scene.maxBounds);
+        m_boundsOverlay->SetBoxes(scene.placeholderBounds);
+        m_pendingScene = std::move(scene);
+        m_redrawRequested = true;
+    }
+}
+
+void Application::UpdateStreaming()
+{
+    if (!m_payloadStreamer || m_pendingScene)
+    {
+        return;
+    }
+
+    // Only a busy streamer loads or unloads payloads, which edits the stage the page warmer reads
+    AnimationPageWarmer::PauseScope pause(m_payloadStreamer->IsBusy() ? m_pageWarmer.get() : nullptr);
+    if (m_payloadStreamer->Update(m_camera))
+    {
+        m_boundsOverlay->SetBoxes(m_payloadStreamer->GetUnloadedBounds());
+        m_redrawRequested = true;
+    }
+}
+
+void Application::UpdatePlayback()
+{
+    if (m_timeline.Update())
+    {
+        m_redrawRequested = true;
+    }
+    if (m_pageWarmer)
+    {
+        m_pageWarmer->SetPlayhead(m_timeline.GetTime().GetValue(), m_timeline.GetFrameStep());
+    }
+}
+
+void Application::UpdateLiveReload()
+{
+    // Layers are only reloaded between loads, as the loader may be composing some of them
+    if (!m_options.watchLayers || !m_stage || m_pendingScene || m_sceneLoader.IsLoading())
+    {
+        return;
+    }
+
+    // Follow sublayers and payloads that were added or removed
+    if (m_watchedLayersChanged)
+    {
+        std::vector<std::string> files;
+        for (const pxr::SdfLayerHandle &layer : m_stage->GetUsedLayers())
+        {
+            std::error_code error;
+            const std::string &realPath = layer->GetRealPath();
+            if (!layer->IsAnonymous() && !realPath.empty() && std::filesystem::is_regular_file(realPath, error))
+            {
+                files.push_back(realPath);
+            }
+        }
+        m_layerWatcher.SetFiles(files);
+        m_watchedLayersChanged = false;
+    }
+
+    std::vector<std::string> changed = m_layerWatcher.Poll();
+    if (changed.empty())
+    {
+        return;
+    }
+
+    std::set<pxr::SdfLayerHandle> layers;
+    for (const pxr::SdfLayerHandle &layer : m_stage->GetUsedLayers())
+    {
+        if (std::find(changed.begin(), changed.end(), layer->GetRealPath()) != changed.end())
+        {
+            layers.insert(layer);
+        }
+    }
+
+    // Reloading in place sends change notices for just these layers, so the stage recomposes the prims they
+    // contribute to and the live engine resyncs those, instead of loading the scene again
+    auto start = std::chrono::steady_clock::now();
+    {
+        AnimationPageWarmer::PauseScope pause(m_pageWarmer.get());
+        if (!pxr::SdfLayer::ReloadLayers(layers))
+        {
+            std::cerr << "Failed to reload some of the changed layers." << std::endl;
+        }
+    }
+    double reloadMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    for (const pxr::SdfLayerHandle &layer : layers)
+    {
+        std::cout << "Reloaded " << layer->GetIdentifier() << std::endl;
+    }
+    std::printf("Reloaded %zu layers in %.1f ms\n", layers.size(), reloadMs);
+    std::fflush(stdout);
+    m_redrawRequested = true;
+}
+
+void Application::UpdateEnvironmentLoading()
+{
+    LoadedEnvironment environment;
+    if (!m_environmentLoader.Poll(environment))
+    {
+        return;
+    }
+
+    if (environment.fromCache)
+    {
+        std::cout << "Dome light: " << environment.sourceFile << " (cached " << environment.width << "x"
+                  << environment.height << ")" << std::endl;
+    }
+    else if (environment.textureFile != environment.sourceFile)
+    {
+        std::cout << "Dome light: " << environment.sourceFile << " (decoded and reduced to " << environment.width
+                  << "x" << environment.height << " in " << environment.loadMs << " ms)" << std::endl;
+    }
+
+    // Applied with the scene if none is loaded yet
+    m_domeLightTexture = environment.textureFile;
+    if (m_engine)
+    {
+        SetupLighting();
+    }
+}
+
+pxr::UsdStage::InitialLoadSet Application::GetInitialLoadSet() const
+{
+    return m_options.streamPayloads ? pxr::UsdStage::LoadNone : pxr::UsdStage::LoadAll;
+}
+
+void Application::ReportSceneSwitch()
+{
+    // Include the GPU work of the first frame (texture uploads, buffer fills)
+    {
+        LoadPhaseScope phase(m_loadProfiler.GetPhases(), "First Frame GPU");
+        glFinish();
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    m_lastSwitchMs = ElapsedMs(m_switchRequested, now);
+    m_measuringSwitch = false;
+
+    std::cout << "Scene switch: " << m_lastSwitchMs << " ms (load " << m_switchLoadMs << " ms, apply "
+              << m_switchApplyMs << " ms, first frame " << ElapsedMs(m_switchApplied, now) << " ms)" << std::endl;
+    m_loadProfiler.End();
+}
+
+void Application::InitHydra()
+{
+    // Engines come and go with stages and isolation changes. They share one Hgi, so the GL device outlives them;
+    // each engine's own buffers and textures are rebuilt, and its shaders come from the driver's shader cache.
+    if (!m_hgi)
+    {
+        m_hgi = pxr::Hgi::CreatePlatformDefaultHgi();
+        m_hgiInterop.reset(new pxr::HgiInterop());
+    }
+
+    // Initialize Engine. It reads its excluded paths once, when it populates.
+    pxr::UsdImagingGLEngine::Parameters parameters;
+    m_engineExcludedPaths = GetEngineExcludedPaths();
+    parameters.excludedPaths = m_engineExcludedPaths;
+    parameters.driver = pxr::HdDriver{pxr::HgiTokens->renderDriver, pxr::VtValue(m_hgi.get())};
+    m_engine.reset(new pxr::UsdImagingGLEngine(parameters));
+
+    std::cout << "Renderer plugin: " << m_engine->GetCurrentRendererId() << std::endl;
+    std::cout << "Renderer HGI backend: " << m_engine->GetRendererHgiDisplayName() << std::endl;
+
+    SetDirectPresent(m_options.directPresent);
+    SetupLighting();
+}
+
+void Application::OnStageChanged(const pxr::UsdNotice::ObjectsChanged &notice)
+{
+    // Edits, payload loads and dome light changes all have to reach the screen
+    m_redrawRequested = true;
+    if (!notice.GetResyncedPaths().empty())
+    {
+        m_watchedLayersChanged = true;
+        m_isolationStale = m_isolationStale || !m_renderRoot.IsAbsoluteRootPath();
+    }
+    if (m_sceneBvh)
+    {
+        m_sceneBvh->OnObjectsChanged(notice);
+    }
+    if (m_boundsCache)
+    {
+        m_boundsCache->OnObjectsChanged(notice);
+    }
+}
+
+void Application::SetupLighting()
+{
+    // Setup lighting
+    if (m_domeLightTexture.empty())
+    {
+        SetupDefaultLighting();
+    }
+    else
+    {
+        SetupDomeLight();
+    }
+    m_redrawRequested = true;
+}
+
+void Application::SetupDefaultLighting()
+{
+    // Setup default lighting
+
+    pxr::GlfSimpleLightVector lights;
+
+    // === Key Light:
+    {
+        pxr::GlfSimpleLight key;
+        key.SetPosition(pxr::GfVec4f(800.0f, 200.0f, 800.0f, 1.0f));
+
+        pxr::GfVec4f warmSRGB{1.0f,0.95f,0.9f,1.0f};
+        key.SetDiffuse(0.8f * ToLinear(warmSRGB));
+        key.SetAmbient(ToLinear({0.05f, 0.05f, 0.05f, 1.0f}));
+        key.SetSpecular(ToLinear({0.8f, 0.8f, 0.8f, 1.0f}));
+        key.SetSpotDirection(pxr::GfVec3f(0, 0, -1));
+        lights.push_back(key);
+    }
+
+    // === Fill Light:
+    {
+        pxr::GlfSimpleLight fill;
+        fill.SetPosition(pxr::GfVec4f(-600.0f, 100.0f, 900.0f, 1.0f));
+
+        fill.SetDiffuse(ToLinear({0.6f, 0.7f, 1.0f, 1.0f}));
+        fill.SetAmbient(ToLinear({0.05f, 0.05f, 0.05f, 1.0f}));
+        fill.SetSpecular(ToLinear({0.5f, 0.5f, 0.5f, 1.0f}));
+        fill.SetSpotDirection(pxr::GfVec3f(0, 0, -1));
+        lights.push_back(fill);
+    }
+
+    // === Back Light:
+    {
+        pxr::GlfSimpleLight back;
+        back.SetPosition(pxr::GfVec4f(0.0f, 300.0f, -400.0f, 1.0f));
+
+        back.SetDiffuse(ToLinear({0.3f, 0.3f, 0.4f, 1.0f}));
+        back.SetAmbient(ToLinear({0.02f, 0.02f, 0.02f, 1.0f}));
+        back.SetSpecular(ToLinear({0.3f, 0.3f, 0.3f, 1.0f}));
+        back.SetSpotDirection(pxr::GfVec3f(0, 0, 1));
+        lights.push_back(back);
+    }
+
+    // Fallback material
+    pxr::GlfSimpleMaterial material;
+    material.SetAmbient(ToLinear({0.1f, 0.1f, 0.1f, 1.0f}));
+    material.SetSpecular(ToLinear({0.6f, 0.6f, 0.6f, 0.6f}));
+    material.SetShininess(16.0);
+
+    // Ambient light
+    pxr::GfVec4f sceneAmbient = ToLinear({0.1f, 0.1f, 0.1f, 1.0f});
+
+    // Update renderer
+    m_engine->SetLightingState(lights, material, sceneAmbient);
+}
+
+void Application::SetupDomeLight()
+{
+    // Setup dome light
+    AnimationPageWarmer::PauseScope pause(m_pageWarmer.get());
+    pxr::UsdLuxDomeLight domeLight = pxr::UsdLuxDomeLight::Define(m_stage, kDomeLightPath);
+    domeLight.CreateTextureFileAttr().Set(pxr::SdfAssetPath(m_domeLightTexture));
+
+    // The dome light replaces the default lights on the live engine
+    m_engine->SetLightingState(pxr::GlfSimpleLightVector(), pxr::GlfSimpleMaterial(), pxr::GfVec4f(0.0f));
+}
+
+void Application::SetFrameLatency(uint32_t latency)
+{
+    // Frames still in flight may be drawing into the targets that are replaced
+    glFinish();
+    m_framePacer = latency > 0 ? std::make_unique<FramePacer>(latency) : nullptr;
+    if (m_options.headless)
+    {
+        DestroyOffscreenFramebuffer();
+        CreateOffscreenFramebuffer();
+    }
+}
+
+void Application::SetDirectPresent(bool direct)
+{
+    // The engine's present task composites the AOV into the bound framebuffer, which TransferToApp then does
+    // again; the direct path skips both for a single blit
+    m_options.directPresent = direct;
+    if (m_engine)
+    {
+        m_engine->SetEnablePresentation(!direct);
+    }
+    m_redrawRequested = true;
+}
+
+void Application::SetHeadlessSize(uint32_t width, uint32_t height)
+{
+    // Recreates the offscreen targets at the new size
+    m_framebufferWidth = width;
+    m_framebufferHeight = height;
+    m_camera.ResizeViewport(width, height);
+    SetFrameLatency(m_options.frameLatency);
+}
+
+void Application::CreateOffscreenFramebuffer()
+{
+    // One target per frame in flight, so a frame never draws into one the GPU is still reading
+    m_offscreenTargets.resize(m_framePacer ? m_framePacer->GetLatency() : 1);
+    for (OffscreenTarget &target : m_offscreenTargets)
+    {
+        glGenRenderbuffers(1, &target.color);
+        glBindRenderbuffer(GL_RENDERBUFFER, target.color);
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, m_framebufferWidth, m_framebufferHeight);
+
+        glGenRenderbuffers(1, &target.depth);
+        glBindRenderbuffer(GL_RENDERBUFFER, target.depth);
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, m_framebufferWidth, m_framebufferHeight);
+        glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+        glGenFramebuffers(1, &target.framebuffer);
+        glBindFramebuffer(GL_FRAMEBUFFER, target.framebuffer);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, target.color);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, target.depth);
+        if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+        {
+            std::cerr << "Offscreen framebuffer is incomplete." << std::endl;
+        }
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    m_offscreenFramebuffer = m_offscreenTargets.front().framebuffer;
+
+    CHECK_GL_ERROR(__LINE__);
+}
+
+void Application::DestroyOffscreenFramebuffer()
+{
+    for (OffscreenTarget &target : m_offscreenTargets)
+    {
+        glDeleteFramebuffers(1, &target.framebuffer);
+        glDeleteRenderbuffers(1, &target.color);
+        glDeleteRenderbuffers(1, &target.depth);
+    }
+    m_offscreenTargets.clear();
+    m_offscreenFramebuffer = 0;
+}
+
+void Application::ToggleCameraRecording()
+{
+    if (!m_recordingCameraPath)
+    {
+        // Start from the home view, which is where playback starts after loading the scene
+        if (m_boundsCache)
+        {
+            glm::vec3 minBounds, maxBounds;
+            ComputeSceneBounds(*m_boundsCache, minBounds, maxBounds, m_timeline.GetTime());
+            m_camera.ResetToModel(minBounds, maxBounds);
+        }
+
+        m_cameraPath.Clear();
+        m_controls->SetRecorder(&m_cameraPath);
+        m_recordingCameraPath = true;
+        std::cout << "Recording camera path... (press R again to stop)" << std::endl;
+    }
+    else
+    {
+        m_controls->SetRecorder(nullptr);
+        m_recordingCameraPath = false;
+
+        std::string filename = m_options.cameraPathFile.empty() ? "camera_path.txt" : m_options.cameraPathFile;
+        if (m_cameraPath.Save(filename))
+        {
+            std::cout << "Saved " << m_cameraPath.GetStepCount() << " camera steps to " << filename << std::endl;
+        }
+    }
+}
+
+void Application::TakeScreenshot()
+{
+    if (!m_frameCapture)
+    {
+        m_frameCapture = std::make_unique<FrameCapture>();
+    }
+
+    std::filesystem::path directory = m_options.captureDir.empty() ? "." : m_options.captureDir;
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+
+    char name[64];
+    std::time_t now = std::time(nullptr);
+    std::strftime(name, sizeof(name), "screenshot_%Y%m%d_%H%M%S.", std::localtime(&now));
+    m_captureFile = (directory / (name + m_options.captureFormat)).string();
+    m_redrawRequested = true;
+    std::cout << "Screenshot: " << m_captureFile << std::endl;
+}
@@ -1,28 +1,47 @@
 #pragma once
 
 // Standard Library Headers
+#include <chrono>
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <string>
+#include <vector>
 
 // Project Headers
+#include "animation_page_warmer.h"
+#include "batch_benchmark.h"
+#include "bounds_cache.h"
+#include "bounds_overlay.h"
 #include "camera.h"
-#include "fps_counter.h"
+#include "camera_path.h"
+#include "environment_loader.h"
+#include "frame_capture.h"
+#include "frame_pacer.h"
+#include "frame_profiler.h"
+#include "layer_watcher.h"
+#include "load_profiler.h"
+#include "options.h"
 #include "orbit_controls.h"
+#include "payload_streamer.h"
+#include "program_cache.h"
+#include "resolution_controller.h"
+#include "scene_loader.h"
+#include "timeline.h"
 #include "usd_headers.h"
 
 // Forward Declarations
 struct GLFWwindow;
 
 // Application Class
-class Application
+class Application : public pxr::TfWeakBase
 {
   public:
     // Static Instance Getter
     static Application *GetInstance();
 
     // Constructor and Destructor
-    explicit Application(uint32_t width, uint32_t height);
+    explicit Application(uint32_t width, uint32_t height, const Options &options = Options());
     ~Application();
 
     // Deleted Functions
@@ -32,41 +51,172 @@ class Application
     Application &operator=(Application &&) = delete;
 
     // Public Interface
-    void Run();
+    bool Run();
     void OnKeyPressed(int key, int mods);
     void OnResize(int width, int height);
+
+    /// With `data`, a USD file is opened in place from that buffer instead of from `filename` (which only names
+    /// it). The buffer is not copied and must stay valid while the scene is loaded.
     void OnFileDropped(const std::string &filename, uint8_t *data = 0, int length = 0);
 
   private:
     // Private Member Functions
     void MainLoop();
+    bool NeedsRedraw() const;
+    bool UseProxyPurpose(bool cameraMoved) const;
+    bool IsBusy() const;
+    bool RunBenchmark();
+    bool RunSceneSwitchBenchmark();
+    bool RunBatchBenchmark();
+    bool RunScalingBenchmark();
+    bool RunPresentBenchmark();
+    bool RunTurntableCapture();
+    BenchmarkResult RunBenchmarkCase(const BenchmarkCase &benchmarkCase);
+    void RenderBenchmarkFrames(const CameraPath &path, uint32_t frameCount, bool animate);
+    void Shutdown();
     void ProcessFrame();
+    void DrawPlaceholders();
+    void BlitAovTexture(const pxr::HgiTextureHandle &texture);
+    void PresentFrame();
+    std::string GetSceneSource(const std::string &filename) const;
+    pxr::UsdStagePopulationMask GetPopulationMask() const;
+    SceneRequest GetSceneRequest(const std::string &source) const;
+    pxr::SdfPath ToModelPath(const std::string &path) const;
+    void RequestScene(const std::string &filename);
     void LoadScene(const std::string &filename);
+    void ApplyScene(LoadedScene scene);
+    void UnloadScene();
+    void PickAt(const glm::vec2 &position);
+    void FrameSelection();
+    void SetIsolation(const pxr::SdfPath &renderRoot, const pxr::SdfPathVector &excludedPaths);
+    pxr::SdfPathVector GetEngineExcludedPaths() const;
+    void SetPopulationMask(const std::vector<std::string> &paths);
+    void PrintOutline();
+    void UpdateSceneLoading();
+    void UpdateStreaming();
+    void UpdatePlayback();
+    void UpdateLiveReload();
+    void UpdateEnvironmentLoading();
+    pxr::UsdStage::InitialLoadSet GetInitialLoadSet() const;
+    void ReportSceneSwitch();
+    void OnStageChanged(const pxr::UsdNotice::ObjectsChanged &notice);
     void InitHydra();
+    void SetupLighting();
     void SetupDefaultLighting();
     void SetupDomeLight();
+    void SetFrameLatency(uint32_t latency);
+    void SetDirectPresent(bool direct);
+    void SetHeadlessSize(uint32_t width, uint32_t height);
+    void CreateOffscreenFramebuffer();
+    void DestroyOffscreenFramebuffer();
+    void ToggleCameraRecording();
+    void TakeScreenshot();
 
     // Static Instance
     static Application *s_instance;
 
     // App Variables
+    Options m_options;
     uint32_t m_windowWidth;
     uint32_t m_windowHeight;
     uint32_t m_framebufferWidth = 0;
     uint32_t m_framebufferHeight = 0;
     bool m_quitApp = false;
-    FpsCounter m_fpsCounter;
+    FrameProfiler m_profiler;
+
+    // Render on Demand (what the last frame showed; anything else changing requests a redraw)
+    bool m_redrawRequested = true;
+    glm::mat4 m_renderedViewMatrix{0.0f};
+    glm::mat4 m_renderedProjectionMatrix{0.0f};
+    pxr::TfNotice::Key m_stageChangedKey;
+
+    // Adaptive Resolution (lowered while navigating, upscaled by TransferToApp or the direct blit)
+    ResolutionController m_resolution;
+
+    // Adaptive LOD (proxy purpose while navigating, for scenes that author proxies)
+    bool m_sceneHasProxies = false;
+    bool m_showingProxy = false;
+
+    // Threading (Hydra sync runs in the render arena when threads are reserved for it)
+    std::unique_ptr<tbb::task_arena> m_renderArena;
 
     // Window and Camera Controls
     GLFWwindow *m_window = nullptr;
     Camera m_camera;
     std::unique_ptr<OrbitControls> m_controls;
+    CameraPath m_cameraPath;
+    bool m_recordingCameraPath = false;
+
+    // Offscreen Framebuffers (headless mode only, one per frame in flight; 0 renders to the window)
+    struct OffscreenTarget
+    {
+        uint32_t framebuffer = 0;
+        uint32_t color = 0;
+        uint32_t depth = 0;
+    };
+    std::vector<OffscreenTarget> m_offscreenTargets;
+    uint32_t m_offscreenFramebuffer = 0; // Target of the current frame
+
+    // Frame Pacing (null leaves it to the driver how far the CPU runs ahead)
+    std::unique_ptr<FramePacer> m_framePacer;
+
+    // Direct Presentation (read framebuffer the engine's color AOV is blitted from, with --direct-present)
+    uint32_t m_aovFramebuffer = 0;
+
+    // Capture (the color AOV of the next full-resolution frame is read back to m_captureFile)
+    std::unique_ptr<FrameCapture> m_frameCapture;
+    std::string m_captureFile;
 
-    // USD Stage and Hydra Engine
+    // USD Stage and Hydra Engine (each scene brings its own stage and gets a new engine; the Hgi persists)
     pxr::UsdStageRefPtr m_stage;
+    pxr::HgiUniquePtr m_hgi;
     std::unique_ptr<pxr::UsdImagingGLEngine> m_engine;
     std::unique_ptr<pxr::HgiInterop> m_hgiInterop;
 
-    // Dome Light
+    // Asynchronous Scene Loading
+    SceneLoader m_sceneLoader;
+    std::optional<LoadedScene> m_pendingScene; // Loaded, shown as placeholders until Hydra takes over
+    std::string m_sceneFile;                   // Path or mem: URI of the scene on the stage
+    std::string m_scenePath;                   // What was asked for, reloaded when the population mask changes
+    std::unique_ptr<ProgramCache> m_programCache;
+    std::unique_ptr<BoundsOverlay> m_boundsOverlay;
+    std::unique_ptr<BoundsCache> m_boundsCache; // Bounds of m_stage, kept up to date across edits and switches
+
+    // Partial Loading (the mask limits what the loader composes; the render root and excluded paths limit what
+    // the engine populates, and changing them recreates it. The viewer's own prims are always populated.)
+    pxr::SdfPath m_defaultPrimPath; // Of the scene on the stage, which /World/Model stands in for
+    pxr::SdfPath m_renderRoot = pxr::SdfPath::AbsoluteRootPath();
+    pxr::SdfPathVector m_excludedPaths;
+    pxr::SdfPathVector m_engineExcludedPaths; // What the engine was built with, including the isolation siblings
+    bool m_isolationStale = false;            // A resync may have changed the siblings to exclude
+
+    // Live Reload (the watched files follow the stage's used layers)
+    LayerWatcher m_layerWatcher;
+    bool m_watchedLayersChanged = false;
+
+    // Picking (the hierarchy is copied from the loaded scene, then refit as the stage changes)
+    std::unique_ptr<SceneBvh> m_sceneBvh;
+    pxr::SdfPath m_selectedPath;
+
+    // Scene Switch Latency (from the request to the first rendered frame of the new scene)
+    std::chrono::steady_clock::time_point m_switchRequested;
+    std::chrono::steady_clock::time_point m_switchApplied;
+    double m_switchLoadMs = 0.0;
+    double m_switchApplyMs = 0.0;
+    double m_lastSwitchMs = 0.0;
+    bool m_measuringSwitch = false;
+
+    // Load Profiling (phases of each load, through the first frame of the new scene)
+    LoadProfiler m_loadProfiler;
+
+    // Payload Streaming (with --stream-payloads)
+    std::unique_ptr<PayloadStreamer> m_payloadStreamer;
+
+    // Animation Playback
+    Timeline m_timeline;
+    std::unique_ptr<AnimationPageWarmer> m_pageWarmer; // Pause it around stage edits
+
+    // Dome Light (dropped HDRIs are prepared in the background; the current lighting stays until then)
     std::string m_domeLightTexture = "";
+    EnvironmentLoader m_environmentLoader;
 };
\ No newline at end of file
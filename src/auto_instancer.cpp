@@ -0,0 +1,214 @@
+// Standard Library Headers
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+// Project Headers
+#include "auto_instancer.h"
+#include "scene_stats.h"
+
+//----------------------------------------------------------------------
+// Internal Utility Functions
+
+namespace
+{
+
+constexpr size_t kBytesPerPoint = 3 * sizeof(float);
+
+// True if a layer of the node's layer stack has prim specs below the node's path (overrides of descendants)
+bool HasDescendantSpecs(const pxr::PcpNodeRef &node)
+{
+    for (const pxr::SdfLayerRefPtr &layer : node.GetLayerStack()->GetLayers())
+    {
+        pxr::SdfPrimSpecHandle spec = layer->GetPrimAtPath(node.GetPath());
+        if (spec && !spec->GetNameChildren().empty())
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Identifies the arcs introduced at `prim`. Returns an empty key if the prim can't be instanced: it has no
+// reference or payload, or opinions from outside those arcs would be lost because they override its descendants.
+std::string GetInstanceKey(const pxr::UsdPrim &prim)
+{
+    if (prim.IsInstanceable() || !(prim.HasAuthoredReferences() || prim.HasAuthoredPayloads()))
+    {
+        return std::string();
+    }
+
+    std::string key;
+    for (const pxr::PcpNodeRef &node : prim.GetPrimIndex().GetNodeRange())
+    {
+        if (!node.CanContributeSpecs())
+        {
+            continue;
+        }
+        if (!IsIntroducedAtPrim(node))
+        {
+            // The prim's own properties stay per instance, but overrides below it would not
+            if (HasDescendantSpecs(node))
+            {
+                return std::string();
+            }
+            continue;
+        }
+        if (node.GetDepthBelowIntroduction() == 0)
+        {
+            const pxr::SdfLayerHandle &layer = node.GetLayerStack()->GetIdentifier().rootLayer;
+            key += std::to_string(static_cast<int>(node.GetArcType())) + ":" +
+                   (layer ? layer->GetIdentifier() : std::string()) + "<" + node.GetPath().GetString() + ">;";
+        }
+    }
+    return key;
+}
+
+// Prims and points below (and including) `prim`
+void CountSubtree(const pxr::UsdPrim &prim, size_t &primCount, uint64_t &pointCount)
+{
+    for (const pxr::UsdPrim &descendant : pxr::UsdPrimRange(prim))
+    {
+        primCount++;
+        pxr::UsdGeomPointBased pointBased(descendant);
+        pxr::VtVec3fArray points;
+        if (pointBased && pointBased.GetPointsAttr().Get(&points, pxr::UsdTimeCode::EarliestTime()))
+        {
+            pointCount += points.size();
+        }
+    }
+}
+
+} // namespace
+
+//----------------------------------------------------------------------
+// Auto Instancing
+
+InstanceCandidates FindInstanceCandidates(const pxr::UsdStageRefPtr &stage)
+{
+    InstanceCandidates candidates;
+    if (!stage)
+    {
+        return candidates;
+    }
+
+    std::vector<pxr::UsdPrim> prims;
+    for (const pxr::UsdPrim &prim : stage->Traverse())
+    {
+        prims.push_back(prim);
+    }
+
+    std::vector<std::string> keys(prims.size());
+    pxr::WorkParallelForN(prims.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i)
+        {
+            keys[i] = GetInstanceKey(prims[i]);
+        }
+    });
+
+    // Group prims by key, in traversal order
+    std::unordered_map<std::string, std::vector<size_t>> groups;
+    for (size_t i = 0; i < prims.size(); ++i)
+    {
+        if (!keys[i].empty())
+        {
+            groups[keys[i]].push_back(i);
+        }
+    }
+
+    std::unordered_set<pxr::SdfPath, pxr::SdfPath::Hash> selected;
+    for (const auto &[key, members] : groups)
+    {
+        if (members.size() >= 2)
+        {
+            for (size_t i : members)
+            {
+                selected.insert(prims[i].GetPath());
+            }
+        }
+    }
+
+    // A prim below another candidate ends up inside that candidate's prototype anyway
+    auto hasSelectedAncestor = [&selected](const pxr::SdfPath &path) {
+        for (pxr::SdfPath parent = path.GetParentPath(); !parent.IsEmpty(); parent = parent.GetParentPath())
+        {
+            if (selected.count(parent))
+            {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    for (const auto &[key, members] : groups)
+    {
+        std::vector<size_t> outermost;
+        for (size_t i : members)
+        {
+            if (selected.count(prims[i].GetPath()) && !hasSelectedAncestor(prims[i].GetPath()))
+            {
+                outermost.push_back(i);
+            }
+        }
+        if (outermost.size() < 2)
+        {
+            continue;
+        }
+
+        // Every copy after the first shares the prototype instead of being populated again
+        size_t primCount = 0;
+        uint64_t pointCount = 0;
+        CountSubtree(prims[outermost.front()], primCount, pointCount);
+        candidates.groupCount++;
+        candidates.sharedPrimCount += primCount * (outermost.size() - 1);
+        candidates.sharedPointCount += pointCount * (outermost.size() - 1);
+        for (size_t i : outermost)
+        {
+            candidates.paths.push_back(prims[i].GetPath());
+        }
+    }
+
+    std::sort(candidates.paths.begin(), candidates.paths.end());
+    return candidates;
+}
+
+void SetSessionInstanceable(const pxr::UsdStageRefPtr &stage, const pxr::SdfPath &root,
+                            const std::vector<pxr::SdfPath> &paths)
+{
+    // One change notification for the whole batch, so the stage recomposes once
+    pxr::SdfLayerHandle sessionLayer = stage->GetSessionLayer();
+    pxr::SdfChangeBlock changeBlock;
+
+    pxr::SdfPrimSpecHandle rootSpec = sessionLayer->GetPrimAtPath(root);
+    if (rootSpec)
+    {
+        rootSpec->GetRealNameParent()->RemoveNameChild(rootSpec);
+    }
+
+    for (const pxr::SdfPath &path : paths)
+    {
+        pxr::SdfPrimSpecHandle spec = pxr::SdfCreatePrimInLayer(sessionLayer, path);
+        if (spec)
+        {
+            spec->SetInstanceable(true);
+        }
+    }
+}
+
+void PrintInstanceCandidates(const InstanceCandidates &candidates)
+{
+    if (candidates.paths.empty())
+    {
+        std::printf("Auto-instancing: no duplicate references found\n");
+        return;
+    }
+
+    double pointMB = candidates.sharedPointCount * kBytesPerPoint / (1024.0 * 1024.0);
+    std::printf("Auto-instancing: %zu prims share %zu prototypes; %zu prims and %llu points (%.1f MB of positions) "
+                "are no longer populated per copy\n",
+                candidates.paths.size(), candidates.groupCount, candidates.sharedPrimCount,
+                static_cast<unsigned long long>(candidates.sharedPointCount), pointMB);
+    std::fflush(stdout);
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+// Standard Library Headers
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Project Headers
+#include "usd_headers.h"
+
+// Auto Instancing
+//
+// Many assemblies reference the same asset over and over without marking the copies instanceable, so Hydra
+// populates and stores each copy separately. Prims whose composition arcs (references, payloads and the arcs
+// inside them) are identical, and that have no local opinions below them, can share one prototype without
+// changing what is drawn. Marking them instanceable in the session layer leaves the scene's files untouched.
+
+// Prims that can be instanced, found on a composed stage
+struct InstanceCandidates
+{
+    std::vector<pxr::SdfPath> paths; // Outermost prims only; no path is below another
+    size_t groupCount = 0;           // Distinct prototypes the paths share
+    size_t sharedPrimCount = 0;      // Prims below the candidates that no longer have to be populated per copy
+    uint64_t sharedPointCount = 0;   // Points of those prims
+};
+
+// Finds uninstanced prims with identical arcs, in parallel. Groups of a single prim are left alone.
+InstanceCandidates FindInstanceCandidates(const pxr::UsdStageRefPtr &stage);
+
+// Marks `paths` instanceable in the stage's session layer, replacing what an earlier call authored under `root`.
+// An empty list just clears those opinions.
+void SetSessionInstanceable(const pxr::UsdStageRefPtr &stage, const pxr::SdfPath &root,
+                            const std::vector<pxr::SdfPath> &paths);
+
+// Prints how many prims were instanced and how much Hydra no longer has to populate separately.
+void PrintInstanceCandidates(const InstanceCandidates &candidates);
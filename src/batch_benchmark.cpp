@@ -0,0 +1,278 @@
+// Standard Library Headers
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+
+// Project Headers
+#include "batch_benchmark.h"
+#include "usd_headers.h"
+
+//----------------------------------------------------------------------
+// Internal Utility Functions
+
+namespace
+{
+
+bool ParseJsonFile(const std::string &filename, pxr::JsObject &object)
+{
+    std::ifstream file(filename);
+    if (!file)
+    {
+        std::cerr << "Failed to open " << filename << std::endl;
+        return false;
+    }
+
+    pxr::JsParseError error;
+    pxr::JsValue value = pxr::JsParseStream(file, &error);
+    if (!value.IsObject())
+    {
+        std::cerr << filename << ":" << error.line << ": "
+                  << (error.reason.empty() ? "expected an object" : error.reason) << std::endl;
+        return false;
+    }
+
+    object = value.GetJsObject();
+    return true;
+}
+
+// Optional members; the value is left unchanged if the key is missing or has the wrong type
+void GetNumber(const pxr::JsObject &object, const char *key, double &value)
+{
+    auto it = object.find(key);
+    if (it != object.end() && (it->second.IsReal() || it->second.IsInt()))
+    {
+        value = it->second.IsInt() ? static_cast<double>(it->second.GetInt64()) : it->second.GetReal();
+    }
+}
+
+void GetUInt(const pxr::JsObject &object, const char *key, uint32_t &value)
+{
+    auto it = object.find(key);
+    if (it != object.end() && it->second.IsInt() && it->second.GetInt64() >= 0)
+    {
+        value = static_cast<uint32_t>(it->second.GetInt64());
+    }
+}
+
+void GetString(const pxr::JsObject &object, const char *key, std::string &value)
+{
+    auto it = object.find(key);
+    if (it != object.end() && it->second.IsString())
+    {
+        value = it->second.GetString();
+    }
+}
+
+void GetBool(const pxr::JsObject &object, const char *key, bool &value)
+{
+    auto it = object.find(key);
+    if (it != object.end() && it->second.IsBool())
+    {
+        value = it->second.GetBool();
+    }
+}
+
+// Returns the array member `key`, or an empty array
+pxr::JsArray GetArray(const pxr::JsObject &object, const char *key)
+{
+    auto it = object.find(key);
+    return it != object.end() && it->second.IsArray() ? it->second.GetJsArray() : pxr::JsArray();
+}
+
+std::string ResolvePath(const std::filesystem::path &folder, const std::string &path)
+{
+    bool keep = path.empty() || std::filesystem::path(path).is_absolute();
+    return keep ? path : (folder / path).lexically_normal().string();
+}
+
+const BenchmarkResult *FindResult(const std::vector<BenchmarkResult> &results, const std::string &name)
+{
+    for (const BenchmarkResult &result : results)
+    {
+        if (result.name == name)
+        {
+            return &result;
+        }
+    }
+    return nullptr;
+}
+
+// Prints one metric and returns false if it regressed
+bool CompareMetric(const char *label, double value, double baseline, double relative, double absolute)
+{
+    double limit = baseline * (1.0 + relative) + absolute;
+    bool regressed = value > limit;
+    double change = baseline > 0.0 ? 100.0 * (value - baseline) / baseline : 0.0;
+    std::printf("    %-16s %10.2f  baseline %10.2f  (%+6.1f%%, limit %.2f)%s\n", label, value, baseline, change, limit,
+                regressed ? "  REGRESSION" : "");
+    return !regressed;
+}
+
+} // namespace
+
+//----------------------------------------------------------------------
+// Batch Benchmark Files
+
+bool LoadBenchmarkManifest(const std::string &filename, BenchmarkManifest &manifest)
+{
+    pxr::JsObject root;
+    if (!ParseJsonFile(filename, root))
+    {
+        return false;
+    }
+
+    auto tolerances = root.find("tolerances");
+    if (tolerances != root.end() && tolerances->second.IsObject())
+    {
+        const pxr::JsObject &object = tolerances->second.GetJsObject();
+        BenchmarkTolerances &t = manifest.tolerances;
+        GetNumber(object, "load", t.loadRelative);
+        GetNumber(object, "first_frame", t.firstFrameRelative);
+        GetNumber(object, "frame", t.frameRelative);
+        GetNumber(object, "memory", t.memoryRelative);
+        GetNumber(object, "absolute_ms", t.absoluteMs);
+        GetNumber(object, "absolute_mb", t.absoluteMB);
+    }
+
+    std::filesystem::path folder = std::filesystem::path(filename).parent_path();
+    for (const pxr::JsValue &value : GetArray(root, "stages"))
+    {
+        if (!value.IsObject())
+        {
+            continue;
+        }
+
+        const pxr::JsObject &object = value.GetJsObject();
+        BenchmarkCase benchmarkCase;
+        GetString(object, "file", benchmarkCase.sceneFile);
+        GetString(object, "camera_path", benchmarkCase.cameraPathFile);
+        GetUInt(object, "frames", benchmarkCase.frameCount);
+        GetUInt(object, "warmup", benchmarkCase.warmupFrames);
+        GetBool(object, "play", benchmarkCase.play);
+        GetBool(object, "auto_instance", benchmarkCase.autoInstance);
+        GetUInt(object, "frame_latency", benchmarkCase.frameLatency);
+        GetBool(object, "direct_present", benchmarkCase.directPresent);
+        std::string source;
+        GetString(object, "open_from", source);
+        if (!source.empty() && !ParseSceneSource(source, benchmarkCase.source))
+        {
+            return false;
+        }
+        if (benchmarkCase.sceneFile.empty() || benchmarkCase.frameCount == 0)
+        {
+            std::cerr << filename << ": every stage needs a \"file\" and a non-zero \"frames\" count" << std::endl;
+            return false;
+        }
+
+        benchmarkCase.name = std::filesystem::path(benchmarkCase.sceneFile).stem().string();
+        GetString(object, "name", benchmarkCase.name);
+        benchmarkCase.sceneFile = ResolvePath(folder, benchmarkCase.sceneFile);
+        benchmarkCase.cameraPathFile = ResolvePath(folder, benchmarkCase.cameraPathFile);
+        manifest.cases.push_back(benchmarkCase);
+    }
+
+    if (manifest.cases.empty())
+    {
+        std::cerr << filename << ": no stages to benchmark" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool WriteBenchmarkResults(const std::string &filename, const std::vector<BenchmarkResult> &results)
+{
+    std::ofstream file(filename);
+    if (!file)
+    {
+        std::cerr << "Failed to write benchmark results: " << filename << std::endl;
+        return false;
+    }
+
+    pxr::JsWriter writer(file, pxr::JsWriter::Style::Pretty);
+    writer.BeginObject();
+    writer.WriteKey("stages");
+    writer.BeginArray();
+    for (const BenchmarkResult &result : results)
+    {
+        writer.BeginObject();
+        writer.WriteKeyValue("name", result.name);
+        writer.WriteKeyValue("loaded", result.loaded);
+        writer.WriteKeyValue("load_ms", result.loadMs);
+        writer.WriteKeyValue("first_frame_ms", result.firstFrameMs);
+        writer.WriteKeyValue("frame_ms_p50", result.frameMsP50);
+        writer.WriteKeyValue("frame_ms_p95", result.frameMsP95);
+        writer.WriteKeyValue("peak_rss_mb", result.peakRssMB);
+        writer.EndObject();
+    }
+    writer.EndArray();
+    writer.EndObject();
+    file << "\n";
+
+    std::cout << "Wrote benchmark results to " << filename << std::endl;
+    return true;
+}
+
+bool LoadBenchmarkResults(const std::string &filename, std::vector<BenchmarkResult> &results)
+{
+    pxr::JsObject root;
+    if (!ParseJsonFile(filename, root))
+    {
+        return false;
+    }
+
+    for (const pxr::JsValue &value : GetArray(root, "stages"))
+    {
+        if (!value.IsObject())
+        {
+            continue;
+        }
+
+        const pxr::JsObject &object = value.GetJsObject();
+        BenchmarkResult result;
+        GetString(object, "name", result.name);
+        GetBool(object, "loaded", result.loaded);
+        GetNumber(object, "load_ms", result.loadMs);
+        GetNumber(object, "first_frame_ms", result.firstFrameMs);
+        GetNumber(object, "frame_ms_p50", result.frameMsP50);
+        GetNumber(object, "frame_ms_p95", result.frameMsP95);
+        GetNumber(object, "peak_rss_mb", result.peakRssMB);
+        results.push_back(result);
+    }
+    return true;
+}
+
+bool CompareBenchmarkResults(const std::vector<BenchmarkResult> &results, const std::vector<BenchmarkResult> &baseline,
+                             const BenchmarkTolerances &tolerances)
+{
+    const BenchmarkTolerances &t = tolerances;
+    bool passed = true;
+    std::printf("Benchmark comparison against the baseline:\n");
+    for (const BenchmarkResult &result : results)
+    {
+        std::printf("  %s\n", result.name.c_str());
+        if (!result.loaded)
+        {
+            std::printf("    FAILED to load\n");
+            passed = false;
+            continue;
+        }
+
+        const BenchmarkResult *base = FindResult(baseline, result.name);
+        if (!base || !base->loaded)
+        {
+            std::printf("    no baseline, not compared\n");
+            continue;
+        }
+
+        passed &= CompareMetric("load ms", result.loadMs, base->loadMs, t.loadRelative, t.absoluteMs);
+        passed &= CompareMetric("first frame ms", result.firstFrameMs, base->firstFrameMs, t.firstFrameRelative,
+                                t.absoluteMs);
+        passed &= CompareMetric("frame ms p50", result.frameMsP50, base->frameMsP50, t.frameRelative, t.absoluteMs);
+        passed &= CompareMetric("frame ms p95", result.frameMsP95, base->frameMsP95, t.frameRelative, t.absoluteMs);
+        passed &= CompareMetric("peak rss MB", result.peakRssMB, base->peakRssMB, t.memoryRelative, t.absoluteMB);
+    }
+    std::printf("%s\n", passed ? "No regressions." : "Performance regressions found.");
+    std::fflush(stdout);
+    return passed;
+}
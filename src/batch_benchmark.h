@@ -0,0 +1,67 @@
+#pragma once
+
+// Standard Library Headers
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Project Headers
+#include "options.h"
+
+// One stage of a batch benchmark
+struct BenchmarkCase
+{
+    std::string name;
+    std::string sceneFile;
+    std::string cameraPathFile; // Empty orbits around the model
+    uint32_t frameCount = 300;
+    uint32_t warmupFrames = 10; // Rendered before the steady-state frames are timed
+    bool play = false;          // Advance animated stages one frame per rendered frame
+    bool autoInstance = false;  // Instance duplicate references, as with --auto-instance
+    uint32_t frameLatency = 0;  // Frames the CPU may run ahead of the GPU, as with --frame-latency
+    bool directPresent = false; // Blit the AOV instead of compositing it, as with --direct-present
+    SceneSource source = SceneSource::File;
+};
+
+// Allowed slowdown relative to the baseline before a metric counts as a regression. A metric regresses when it
+// exceeds baseline * (1 + relative) + absolute, so tiny baselines don't fail on noise.
+struct BenchmarkTolerances
+{
+    double loadRelative = 0.25;
+    double firstFrameRelative = 0.25;
+    double frameRelative = 0.15;
+    double memoryRelative = 0.10;
+    double absoluteMs = 2.0;
+    double absoluteMB = 32.0;
+};
+
+struct BenchmarkManifest
+{
+    std::vector<BenchmarkCase> cases;
+    BenchmarkTolerances tolerances;
+};
+
+// Measurements of one stage
+struct BenchmarkResult
+{
+    std::string name;
+    bool loaded = false;
+    double loadMs = 0.0;       // Request to the scene being applied to the stage
+    double firstFrameMs = 0.0; // Request to the first rendered frame, including its GPU work
+    double frameMsP50 = 0.0;   // Steady-state frame times
+    double frameMsP95 = 0.0;
+    double peakRssMB = 0.0;
+};
+
+// Reads a manifest JSON file. Relative scene and camera path files are resolved against the manifest's folder.
+bool LoadBenchmarkManifest(const std::string &filename, BenchmarkManifest &manifest);
+
+// Writes results as JSON; the file can be used as the baseline of later runs.
+bool WriteBenchmarkResults(const std::string &filename, const std::vector<BenchmarkResult> &results);
+
+// Reads results written by WriteBenchmarkResults.
+bool LoadBenchmarkResults(const std::string &filename, std::vector<BenchmarkResult> &results);
+
+// Prints each metric against the baseline. Returns false if any stage failed to load or regressed.
+bool CompareBenchmarkResults(const std::vector<BenchmarkResult> &results, const std::vector<BenchmarkResult> &baseline,
+                             const BenchmarkTolerances &tolerances);
@@ -0,0 +1,197 @@
+// Standard Library Headers
+#include <algorithm>
+
+// Project Headers
+#include "bounds_cache.h"
+
+//----------------------------------------------------------------------
+// Internal Utility Functions
+
+namespace
+{
+
+constexpr size_t kMinSubtrees = 64; // Enough subtrees to keep the workers busy, when the hierarchy has them
+
+glm::vec3 ToVec3(const pxr::GfVec3d &v)
+{
+    return glm::vec3(v[0], v[1], v[2]);
+}
+
+// Groups are split into their children; geometry and instances stay whole, so instances keep sharing the
+// bounds of their prototype
+bool CanSplit(const pxr::UsdPrim &prim)
+{
+    return prim.IsPseudoRoot() || (!prim.IsInstance() && !prim.IsA<pxr::UsdGeomBoundable>() &&
+                                   !prim.GetChildren().empty());
+}
+
+// Shading and primvar edits leave the bounds alone
+bool AffectsBounds(const pxr::SdfPath &path)
+{
+    if (!path.IsPropertyPath())
+    {
+        return true;
+    }
+    const std::string &name = path.GetName();
+    return name.compare(0, 8, "primvars") != 0 && name.compare(0, 8, "material") != 0;
+}
+
+} // namespace
+
+//----------------------------------------------------------------------
+// BoundsCache Class Implementation
+
+BoundsCache::BoundsCache(const pxr::UsdStageRefPtr &stage) : m_stage(stage)
+{
+}
+
+bool BoundsCache::Compute(pxr::UsdTimeCode time, glm::vec3 &minBounds, glm::vec3 &maxBounds)
+{
+    if (!m_stage)
+    {
+        return false;
+    }
+    if (!m_split)
+    {
+        Split();
+    }
+
+    std::vector<Subtree *> stale;
+    for (Subtree &subtree : m_subtrees)
+    {
+        if (!subtree.valid || subtree.time != time)
+        {
+            stale.push_back(&subtree);
+        }
+    }
+
+    // Each subtree has its own cache, so they can be computed side by side
+    pxr::WorkParallelForN(stale.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i)
+        {
+            Subtree &subtree = *stale[i];
+            pxr::UsdPrim prim = m_stage->GetPrimAtPath(subtree.path);
+            subtree.cache->SetTime(time);
+            subtree.bounds = prim ? subtree.cache->ComputeWorldBound(prim).ComputeAlignedRange() : pxr::GfRange3d();
+            subtree.time = time;
+            subtree.valid = true;
+        }
+    });
+
+    pxr::GfRange3d bounds;
+    for (const Subtree &subtree : m_subtrees)
+    {
+        bounds.UnionWith(subtree.bounds);
+    }
+    if (bounds.IsEmpty())
+    {
+        return false;
+    }
+    minBounds = ToVec3(bounds.GetMin());
+    maxBounds = ToVec3(bounds.GetMax());
+    return true;
+}
+
+void BoundsCache::OnObjectsChanged(const pxr::UsdNotice::ObjectsChanged &notice)
+{
+    if (!m_split)
+    {
+        return;
+    }
+    for (const pxr::SdfPath &path : notice.GetResyncedPaths())
+    {
+        Invalidate(path, true);
+    }
+    for (const pxr::SdfPath &path : notice.GetChangedInfoOnlyPaths())
+    {
+        if (AffectsBounds(path))
+        {
+            Invalidate(path, false);
+        }
+    }
+}
+
+void BoundsCache::Split()
+{
+    // Split groups breadth-first until there are enough subtrees
+    std::vector<pxr::UsdPrim> prims = {m_stage->GetPseudoRoot()};
+    bool splitAny = true;
+    while (splitAny && prims.size() < kMinSubtrees)
+    {
+        splitAny = false;
+        std::vector<pxr::UsdPrim> next;
+        for (const pxr::UsdPrim &prim : prims)
+        {
+            if (CanSplit(prim))
+            {
+                for (const pxr::UsdPrim &child : prim.GetChildren())
+                {
+                    next.push_back(child);
+                }
+                splitAny = true;
+            }
+            else
+            {
+                next.push_back(prim);
+            }
+        }
+        prims.swap(next);
+    }
+
+    m_subtrees.clear();
+    m_subtreeIndex.clear();
+    m_subtrees.resize(prims.size());
+    for (size_t i = 0; i < prims.size(); ++i)
+    {
+        m_subtrees[i].path = prims[i].GetPath();
+        m_subtrees[i].cache = std::make_unique<pxr::UsdGeomBBoxCache>(
+            pxr::UsdTimeCode::Default(), pxr::UsdGeomImageable::GetOrderedPurposeTokens(), /* useExtentsHint = */ true);
+    }
+    std::sort(m_subtrees.begin(), m_subtrees.end(),
+              [](const Subtree &a, const Subtree &b) { return a.path < b.path; });
+    for (size_t i = 0; i < m_subtrees.size(); ++i)
+    {
+        m_subtreeIndex[m_subtrees[i].path] = i;
+    }
+    m_split = true;
+}
+
+void BoundsCache::Invalidate(const pxr::SdfPath &path, bool resynced)
+{
+    pxr::SdfPath primPath = path.GetPrimPath();
+
+    // Inside a subtree: only that subtree is affected
+    for (pxr::SdfPath ancestor = primPath; !ancestor.IsEmpty(); ancestor = ancestor.GetParentPath())
+    {
+        auto it = m_subtreeIndex.find(ancestor);
+        if (it == m_subtreeIndex.end())
+        {
+            continue;
+        }
+
+        // A resynced subtree root may have become a group (or stopped being one); split the stage again
+        if (resynced && ancestor == primPath && path.IsPrimPath())
+        {
+            m_split = false;
+            return;
+        }
+        Subtree &subtree = m_subtrees[it->second];
+        subtree.cache->Clear();
+        subtree.valid = false;
+        return;
+    }
+
+    // Above the subtrees: a transform or visibility edit affects every subtree below, a structural one the split
+    if (resynced && path.IsPrimPath())
+    {
+        m_split = false;
+        return;
+    }
+    auto it = std::lower_bound(m_subtrees.begin(), m_subtrees.end(), primPath,
+                               [](const Subtree &subtree, const pxr::SdfPath &p) { return subtree.path < p; });
+    for (; it != m_subtrees.end() && it->path.HasPrefix(primPath); ++it)
+    {
+        it->cache->Clear();
+        it->valid = false;
+    }
+}
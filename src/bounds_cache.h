@@ -0,0 +1,53 @@
+#pragma once
+
+// Standard Library Headers
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+// Third-Party Library Headers
+#include <glm/glm.hpp>
+
+// Project Headers
+#include "usd_headers.h"
+
+// BoundsCache Class
+//
+// Long-lived world bounds of a stage. The stage is split into subtrees below its top-level groups, each with its
+// own UsdGeomBBoxCache, so the subtrees are computed in parallel and an edit only invalidates the subtree it is
+// in. Changing the time keeps the bounds of static prims (UsdGeomBBoxCache only recomputes time-varying entries),
+// and subtrees are not queried again at all while the time stays the same.
+class BoundsCache
+{
+  public:
+    // Constructor
+    explicit BoundsCache(const pxr::UsdStageRefPtr &stage);
+
+    // Deleted Functions
+    BoundsCache(const BoundsCache &) = delete;
+    BoundsCache &operator=(const BoundsCache &) = delete;
+
+    /// World bounds of the whole stage at `time`, all purposes included. Returns false if the stage is empty.
+    bool Compute(pxr::UsdTimeCode time, glm::vec3 &minBounds, glm::vec3 &maxBounds);
+
+    /// Invalidates the subtrees the notice touches; prims added or removed above them split the stage again.
+    void OnObjectsChanged(const pxr::UsdNotice::ObjectsChanged &notice);
+
+  private:
+    struct Subtree
+    {
+        pxr::SdfPath path;
+        std::unique_ptr<pxr::UsdGeomBBoxCache> cache;
+        pxr::GfRange3d bounds;
+        pxr::UsdTimeCode time = pxr::UsdTimeCode::Default();
+        bool valid = false;
+    };
+
+    void Split();
+    void Invalidate(const pxr::SdfPath &primPath, bool resynced);
+
+    pxr::UsdStagePtr m_stage;
+    std::vector<Subtree> m_subtrees; // Sorted by path
+    std::unordered_map<pxr::SdfPath, size_t, pxr::SdfPath::Hash> m_subtreeIndex;
+    bool m_split = false;
+};
@@ -0,0 +1,111 @@
+// Standard Library Headers
+#include <array>
+
+// Third-Party Library Headers
+#include <glad/glad.h>
+
+// Project Headers
+#include "bounds_overlay.h"
+#include "program_cache.h"
+
+//----------------------------------------------------------------------
+// Internal Utility Functions
+
+namespace
+{
+
+const char *kVertexShader = R"(#version 330 core
+layout(location = 0) in vec3 position;
+uniform mat4 viewProjection;
+void main()
+{
+    gl_Position = viewProjection * vec4(position, 1.0);
+}
+)";
+
+const char *kFragmentShader = R"(#version 330 core
+uniform vec4 color;
+out vec4 fragColor;
+void main()
+{
+    fragColor = color;
+}
+)";
+
+// Corner index pairs for the 12 edges of a box (corner bit 0 = x, bit 1 = y, bit 2 = z)
+constexpr std::array<int, 24> kBoxEdges = {0, 1, 2, 3, 4, 5, 6, 7, 0, 2, 1, 3, 4, 6, 5, 7, 0, 4, 1, 5, 2, 6, 3, 7};
+
+} // namespace
+
+//----------------------------------------------------------------------
+// BoundsOverlay Class Implementation
+
+BoundsOverlay::BoundsOverlay(ProgramCache &programCache)
+{
+    m_program = programCache.GetProgram("BoundsOverlay", kVertexShader, kFragmentShader);
+    m_viewProjectionLocation = glGetUniformLocation(m_program, "viewProjection");
+    m_colorLocation = glGetUniformLocation(m_program, "color");
+
+    glGenVertexArrays(1, &m_vertexArray);
+    glGenBuffers(1, &m_vertexBuffer);
+    glBindVertexArray(m_vertexArray);
+    glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(glm::vec3), nullptr);
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+BoundsOverlay::~BoundsOverlay()
+{
+    glDeleteBuffers(1, &m_vertexBuffer);
+    glDeleteVertexArrays(1, &m_vertexArray);
+    glDeleteProgram(m_program);
+}
+
+void BoundsOverlay::SetBoxes(const std::vector<BoundingBox> &boxes)
+{
+    std::vector<glm::vec3> vertices;
+    vertices.reserve(boxes.size() * kBoxEdges.size());
+    for (const BoundingBox &box : boxes)
+    {
+        for (int corner : kBoxEdges)
+        {
+            vertices.emplace_back((corner & 1) ? box.max.x : box.min.x, (corner & 2) ? box.max.y : box.min.y,
+                                  (corner & 4) ? box.max.z : box.min.z);
+        }
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer);
+    glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(glm::vec3), vertices.data(), GL_STATIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    m_vertexCount = static_cast<uint32_t>(vertices.size());
+}
+
+void BoundsOverlay::Clear() noexcept
+{
+    m_vertexCount = 0;
+}
+
+void BoundsOverlay::Draw(const glm::mat4 &viewProjection, const glm::vec4 &color) const
+{
+    if (m_vertexCount == 0)
+    {
+        return;
+    }
+
+    glDisable(GL_DEPTH_TEST);
+    glUseProgram(m_program);
+    glUniformMatrix4fv(m_viewProjectionLocation, 1, GL_FALSE, &viewProjection[0][0]);
+    glUniform4fv(m_colorLocation, 1, &color[0]);
+    glBindVertexArray(m_vertexArray);
+    glDrawArrays(GL_LINES, 0, m_vertexCount);
+    glBindVertexArray(0);
+    glUseProgram(0);
+    glEnable(GL_DEPTH_TEST);
+}
+
+bool BoundsOverlay::IsEmpty() const noexcept
+{
+    return m_vertexCount == 0;
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+// Standard Library Headers
+#include <cstdint>
+#include <vector>
+
+// Third-Party Library Headers
+#include <glm/glm.hpp>
+
+// Axis-aligned box in world space
+struct BoundingBox
+{
+    glm::vec3 min{0.0f};
+    glm::vec3 max{0.0f};
+};
+
+// Forward Declarations
+class ProgramCache;
+
+// BoundsOverlay Class
+//
+// Draws wireframe boxes on top of the current framebuffer, e.g. as placeholders for a scene whose geometry
+// is not ready yet. Requires a current GL context for its whole lifetime.
+class BoundsOverlay
+{
+  public:
+    // Constructor and Destructor
+    explicit BoundsOverlay(ProgramCache &programCache);
+    ~BoundsOverlay();
+
+    // Deleted Functions
+    BoundsOverlay(const BoundsOverlay &) = delete;
+    BoundsOverlay &operator=(const BoundsOverlay &) = delete;
+
+    // Public Interface
+    void SetBoxes(const std::vector<BoundingBox> &boxes);
+    void Clear() noexcept;
+    void Draw(const glm::mat4 &viewProjection, const glm::vec4 &color) const;
+
+    // Accessors
+    bool IsEmpty() const noexcept;
+
+  private:
+    uint32_t m_program = 0;
+    uint32_t m_vertexArray = 0;
+    uint32_t m_vertexBuffer = 0;
+    int32_t m_viewProjectionLocation = -1;
+    int32_t m_colorLocation = -1;
+    uint32_t m_vertexCount = 0;
+};
@@ -0,0 +1,152 @@
+// Standard Library Headers
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+// Project Headers
+#include "camera.h"
+#include "camera_path.h"
+
+//----------------------------------------------------------------------
+// Internal Constants
+
+namespace
+{
+constexpr int kOrbitStep = 8; // Tumble units per frame (~1.8 degrees, so kOrbitTurnSteps make a full turn)
+
+const char *ToString(CameraPath::Operation op)
+{
+    switch (op)
+    {
+    case CameraPath::Operation::Tumble:
+        return "tumble";
+    case CameraPath::Operation::Pan:
+        return "pan";
+    case CameraPath::Operation::Zoom:
+        return "zoom";
+    }
+    return "";
+}
+} // namespace
+
+//----------------------------------------------------------------------
+// CameraPath Class Implementation
+
+CameraPath CameraPath::CreateOrbit()
+{
+    CameraPath path;
+    path.Record(Operation::Tumble, kOrbitStep, 0);
+    return path;
+}
+
+bool CameraPath::Load(const std::string &filename)
+{
+    std::ifstream file(filename);
+    if (!file)
+    {
+        std::cerr << "Failed to open camera path: " << filename << std::endl;
+        return false;
+    }
+
+    std::vector<Step> steps;
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(file, line))
+    {
+        ++lineNumber;
+        if (line.empty() || line[0] == '#')
+        {
+            continue;
+        }
+
+        std::istringstream stream(line);
+        std::string op;
+        Step step{};
+        if (!(stream >> op >> step.dx >> step.dy))
+        {
+            std::cerr << filename << ":" << lineNumber << ": malformed camera path step" << std::endl;
+            return false;
+        }
+
+        if (op == "tumble")
+        {
+            step.op = Operation::Tumble;
+        }
+        else if (op == "pan")
+        {
+            step.op = Operation::Pan;
+        }
+        else if (op == "zoom")
+        {
+            step.op = Operation::Zoom;
+        }
+        else
+        {
+            std::cerr << filename << ":" << lineNumber << ": unknown camera operation '" << op << "'" << std::endl;
+            return false;
+        }
+        steps.push_back(step);
+    }
+
+    m_steps = std::move(steps);
+    return true;
+}
+
+bool CameraPath::Save(const std::string &filename) const
+{
+    std::ofstream file(filename);
+    if (!file)
+    {
+        std::cerr << "Failed to write camera path: " << filename << std::endl;
+        return false;
+    }
+
+    file << "# USD Viewer camera path: <tumble|pan|zoom> <dx> <dy>, one step per frame\n";
+    for (const Step &step : m_steps)
+    {
+        file << ToString(step.op) << " " << step.dx << " " << step.dy << "\n";
+    }
+    return true;
+}
+
+void CameraPath::Record(Operation op, int dx, int dy)
+{
+    m_steps.push_back({op, dx, dy});
+}
+
+void CameraPath::Clear() noexcept
+{
+    m_steps.clear();
+}
+
+void CameraPath::Apply(size_t frameIndex, Camera &camera) const
+{
+    if (m_steps.empty())
+    {
+        return;
+    }
+
+    const Step &step = m_steps[frameIndex % m_steps.size()];
+    switch (step.op)
+    {
+    case Operation::Tumble:
+        camera.Tumble(step.dx, step.dy);
+        break;
+    case Operation::Pan:
+        camera.Pan(step.dx, step.dy);
+        break;
+    case Operation::Zoom:
+        camera.Zoom(step.dx, step.dy);
+        break;
+    }
+}
+
+bool CameraPath::IsEmpty() const noexcept
+{
+    return m_steps.empty();
+}
+
+size_t CameraPath::GetStepCount() const noexcept
+{
+    return m_steps.size();
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+// Standard Library Headers
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// Forward Declarations
+class Camera;
+
+// CameraPath Class
+//
+// A sequence of camera navigation steps (one per frame) that can be recorded from OrbitControls,
+// saved to a text file and played back deterministically after Camera::ResetToModel.
+class CameraPath
+{
+  public:
+    enum class Operation
+    {
+        Tumble,
+        Pan,
+        Zoom
+    };
+
+    struct Step
+    {
+        Operation op;
+        int dx;
+        int dy;
+    };
+
+    // Constructors
+    CameraPath() = default;
+
+    // Factory: a slow orbit around the model, used when no path file is given
+    static CameraPath CreateOrbit();
+
+    // Steps of CreateOrbit() that turn the camera once around the model (to within a degree)
+    static constexpr size_t kOrbitTurnSteps = 196;
+
+    // Public Interface
+    bool Load(const std::string &filename);
+    bool Save(const std::string &filename) const;
+    void Record(Operation op, int dx, int dy);
+    void Clear() noexcept;
+
+    /// Applies the step for `frameIndex` to `camera`. The path loops if it is shorter than the frame count.
+    void Apply(size_t frameIndex, Camera &camera) const;
+
+    // Accessors
+    bool IsEmpty() const noexcept;
+    size_t GetStepCount() const noexcept;
+
+  private:
+    std::vector<Step> m_steps;
+};
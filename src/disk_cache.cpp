@@ -0,0 +1,118 @@
+// Standard Library Headers
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+// Project Headers
+#include "disk_cache.h"
+
+//----------------------------------------------------------------------
+// Internal Utility Functions
+
+namespace
+{
+
+constexpr uint64_t kHashPrime = 0x100000001b3ull;
+constexpr size_t kHashChunk = 1 << 20; // Bytes read at a time while hashing a file
+
+} // namespace
+
+//----------------------------------------------------------------------
+// Hashing
+
+uint64_t HashBytes(const void *data, size_t size, uint64_t hash)
+{
+    const unsigned char *bytes = static_cast<const unsigned char *>(data);
+    for (size_t i = 0; i < size; ++i)
+    {
+        hash = (hash ^ bytes[i]) * kHashPrime;
+    }
+    return hash;
+}
+
+uint64_t HashString(const std::string &text)
+{
+    return HashBytes(text.data(), text.size());
+}
+
+bool HashFile(const std::string &filename, uint64_t &hash)
+{
+    std::ifstream in(filename, std::ios::binary);
+    if (!in)
+    {
+        return false;
+    }
+
+    hash = kHashSeed;
+    std::vector<char> chunk(kHashChunk);
+    while (in)
+    {
+        in.read(chunk.data(), chunk.size());
+        hash = HashBytes(chunk.data(), static_cast<size_t>(in.gcount()), hash);
+    }
+    return true;
+}
+
+std::string FormatHash(uint64_t hash)
+{
+    char text[17];
+    std::snprintf(text, sizeof(text), "%016llx", static_cast<unsigned long long>(hash));
+    return text;
+}
+
+//----------------------------------------------------------------------
+// Cache Files
+
+bool WriteFileAtomically(const std::string &file, const std::function<bool(const std::string &)> &write)
+{
+    std::filesystem::path path(file);
+    std::string tempFile =
+        (path.parent_path() / (path.stem().string() + ".tmp" + path.extension().string())).string();
+
+    std::error_code error;
+    if (!write(tempFile))
+    {
+        std::filesystem::remove(tempFile, error);
+        return false;
+    }
+    std::filesystem::rename(tempFile, file, error);
+    if (error)
+    {
+        std::filesystem::remove(tempFile, error);
+        return false;
+    }
+    return true;
+}
+
+std::string GetUserCacheDirectory(const std::string &name)
+{
+    std::filesystem::path base;
+#if defined(_WIN32)
+    if (const char *localAppData = std::getenv("LOCALAPPDATA"))
+    {
+        base = localAppData;
+    }
+#elif defined(__APPLE__)
+    if (const char *home = std::getenv("HOME"))
+    {
+        base = std::filesystem::path(home) / "Library" / "Caches";
+    }
+#else
+    if (const char *cacheHome = std::getenv("XDG_CACHE_HOME"))
+    {
+        base = cacheHome;
+    }
+    else if (const char *home = std::getenv("HOME"))
+    {
+        base = std::filesystem::path(home) / ".cache";
+    }
+#endif
+    if (base.empty())
+    {
+        std::error_code error;
+        base = std::filesystem::temp_directory_path(error);
+    }
+    return (base / "usd-viewer" / name).string();
+}
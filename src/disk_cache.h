@@ -0,0 +1,31 @@
+#pragma once
+
+// Standard Library Headers
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+// Disk Cache Utilities
+//
+// Shared by the viewer's on-disk caches (linked GL programs, prepared dome light textures).
+
+// FNV-1a, stable across compilers and runs (unlike std::hash). HashBytes() continues from `hash`, so data can be
+// hashed in pieces.
+constexpr uint64_t kHashSeed = 0xcbf29ce484222325ull;
+uint64_t HashBytes(const void *data, size_t size, uint64_t hash = kHashSeed);
+uint64_t HashString(const std::string &text);
+
+// Hashes a file's contents. Returns false if it cannot be read.
+bool HashFile(const std::string &filename, uint64_t &hash);
+
+// The hash as 16 hex digits, for cache file names.
+std::string FormatHash(uint64_t hash);
+
+// Calls `write` with a temporary name next to `file` and renames the result to `file`, so another instance never
+// reads a partial file. The temporary name keeps the extension, for writers that pick the format by it. Returns
+// false if writing or renaming failed.
+bool WriteFileAtomically(const std::string &file, const std::function<bool(const std::string &)> &write);
+
+// Per-user cache directory of the viewer for `name` (e.g. ~/.cache/usd-viewer/shaders on Linux).
+std::string GetUserCacheDirectory(const std::string &name);
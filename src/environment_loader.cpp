@@ -0,0 +1,297 @@
+// Standard Library Headers
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+// Project Headers
+#include "disk_cache.h"
+#include "environment_loader.h"
+#include "usd_headers.h"
+
+//----------------------------------------------------------------------
+// Internal Utility Functions
+
+namespace
+{
+
+constexpr int kMaxWidth = 2048; // Ample for Storm's prefiltered irradiance and specular maps
+
+// Decodes a floating-point image into linear RGB floats
+bool ReadImage(const std::string &filename, int &width, int &height, std::vector<float> &rgb)
+{
+    pxr::HioImageSharedPtr image = pxr::HioImage::OpenForReading(filename);
+    if (!image)
+    {
+        std::cerr << "EnvironmentLoader: cannot open " << filename << std::endl;
+        return false;
+    }
+
+    pxr::HioFormat format = image->GetFormat();
+    pxr::HioType type = pxr::HioGetHioType(format);
+    int channels = pxr::HioGetComponentCount(format);
+    if ((type != pxr::HioTypeFloat && type != pxr::HioTypeHalfFloat) || channels < 3)
+    {
+        std::cerr << "EnvironmentLoader: " << filename << " is not an RGB floating-point image." << std::endl;
+        return false;
+    }
+
+    width = image->GetWidth();
+    height = image->GetHeight();
+    std::vector<uint8_t> pixels(static_cast<size_t>(width) * height * image->GetBytesPerPixel());
+    pxr::HioImage::StorageSpec spec;
+    spec.width = width;
+    spec.height = height;
+    spec.depth = 1;
+    spec.format = format;
+    spec.data = pixels.data();
+    if (!image->Read(spec))
+    {
+        std::cerr << "EnvironmentLoader: cannot decode " << filename << std::endl;
+        return false;
+    }
+
+    rgb.resize(static_cast<size_t>(width) * height * 3);
+    pxr::WorkParallelForN(static_cast<size_t>(height), [&](size_t begin, size_t end) {
+        for (size_t i = begin * width; i < end * width; ++i)
+        {
+            for (int c = 0; c < 3; ++c)
+            {
+                size_t index = i * channels + c;
+                rgb[i * 3 + c] = type == pxr::HioTypeFloat
+                                     ? reinterpret_cast<const float *>(pixels.data())[index]
+                                     : float(reinterpret_cast<const pxr::GfHalf *>(pixels.data())[index]);
+            }
+        }
+    });
+    return true;
+}
+
+// Halves the image with a box filter until it is at most kMaxWidth wide
+void Reduce(int &width, int &height, std::vector<float> &rgb)
+{
+    while (width > kMaxWidth)
+    {
+        int reducedWidth = std::max(1, width / 2);
+        int reducedHeight = std::max(1, height / 2);
+        std::vector<float> reduced(static_cast<size_t>(reducedWidth) * reducedHeight * 3);
+        pxr::WorkParallelForN(static_cast<size_t>(reducedHeight), [&](size_t begin, size_t end) {
+            for (size_t y = begin; y < end; ++y)
+            {
+                size_t y0 = std::min<size_t>(y * 2, height - 1);
+                size_t y1 = std::min<size_t>(y * 2 + 1, height - 1);
+                for (size_t x = 0; x < static_cast<size_t>(reducedWidth); ++x)
+                {
+                    size_t x0 = std::min<size_t>(x * 2, width - 1);
+                    size_t x1 = std::min<size_t>(x * 2 + 1, width - 1);
+                    for (int c = 0; c < 3; ++c)
+                    {
+                        reduced[(y * reducedWidth + x) * 3 + c] =
+                            0.25f * (rgb[(y0 * width + x0) * 3 + c] + rgb[(y0 * width + x1) * 3 + c] +
+                                     rgb[(y1 * width + x0) * 3 + c] + rgb[(y1 * width + x1) * 3 + c]);
+                    }
+                }
+            }
+        });
+        rgb.swap(reduced);
+        width = reducedWidth;
+        height = reducedHeight;
+    }
+}
+
+bool WriteImage(const std::string &filename, int width, int height, std::vector<float> &rgb)
+{
+    pxr::HioImageSharedPtr image = pxr::HioImage::OpenForWriting(filename);
+    pxr::HioImage::StorageSpec spec;
+    spec.width = width;
+    spec.height = height;
+    spec.depth = 1;
+    spec.format = pxr::HioFormatFloat32Vec3;
+    spec.data = rgb.data();
+    return image && image->Write(spec);
+}
+
+} // namespace
+
+//----------------------------------------------------------------------
+// EnvironmentLoader Class Implementation
+
+EnvironmentLoader::EnvironmentLoader(const std::string &cacheDirectory)
+    : m_cacheDirectory(cacheDirectory), m_worker(&EnvironmentLoader::WorkerLoop, this)
+{
+}
+
+EnvironmentLoader::~EnvironmentLoader()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_quit = true;
+        m_request.reset();
+    }
+    m_condition.notify_all();
+    m_worker.join();
+}
+
+void EnvironmentLoader::Request(const std::string &filename)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_request = filename;
+        m_result.reset();
+    }
+    m_condition.notify_all();
+}
+
+bool EnvironmentLoader::Poll(LoadedEnvironment &environment)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_result)
+    {
+        return false;
+    }
+
+    environment = std::move(*m_result);
+    m_result.reset();
+    return true;
+}
+
+bool EnvironmentLoader::IsLoading() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_busy || m_request.has_value();
+}
+
+LoadedEnvironment EnvironmentLoader::Prepare(const std::string &filename) const
+{
+    auto start = std::chrono::steady_clock::now();
+
+    // Without a cache, or if anything below fails, Storm reads the source as before
+    LoadedEnvironment environment;
+    environment.sourceFile = filename;
+    environment.textureFile = filename;
+    uint64_t hash = 0;
+    if (m_cacheDirectory.empty() || !GetContentHash(filename, hash))
+    {
+        return environment;
+    }
+
+    std::string name = FormatHash(hash) + "_" + std::to_string(kMaxWidth) + ".hdr";
+    std::string cachedFile = (std::filesystem::path(m_cacheDirectory) / name).string();
+
+    std::error_code error;
+    if (std::filesystem::exists(cachedFile, error))
+    {
+        if (pxr::HioImageSharedPtr image = pxr::HioImage::OpenForReading(cachedFile))
+        {
+            environment.textureFile = cachedFile;
+            environment.width = image->GetWidth();
+            environment.height = image->GetHeight();
+            environment.fromCache = true;
+        }
+    }
+
+    if (!environment.fromCache)
+    {
+        int width = 0, height = 0;
+        std::vector<float> rgb;
+        if (!ReadImage(filename, width, height, rgb))
+        {
+            return environment;
+        }
+        Reduce(width, height, rgb);
+
+        std::filesystem::create_directories(m_cacheDirectory, error);
+        bool written = WriteFileAtomically(
+            cachedFile, [&](const std::string &tempFile) { return WriteImage(tempFile, width, height, rgb); });
+        if (!written)
+        {
+            std::cerr << "EnvironmentLoader: cannot write " << cachedFile << std::endl;
+            return environment;
+        }
+        environment.textureFile = cachedFile;
+        environment.width = width;
+        environment.height = height;
+    }
+
+    environment.loadMs =
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    return environment;
+}
+
+bool EnvironmentLoader::GetContentHash(const std::string &filename, uint64_t &hash) const
+{
+    // Hashing reads the whole source, hundreds of MB for an 8K EXR, so the result is remembered in an index keyed
+    // by path, size and modification time. Only a new or changed file is read again.
+    std::error_code error;
+    std::filesystem::path absolute = std::filesystem::absolute(filename, error);
+    uintmax_t size = std::filesystem::file_size(filename, error);
+    if (error)
+    {
+        return HashFile(filename, hash);
+    }
+    auto modified = std::filesystem::last_write_time(filename, error);
+    if (error)
+    {
+        return HashFile(filename, hash);
+    }
+
+    std::string key = absolute.string() + '\0' + std::to_string(size) + '\0' +
+                      std::to_string(modified.time_since_epoch().count());
+    std::filesystem::path indexDirectory = std::filesystem::path(m_cacheDirectory) / "index";
+    std::string indexFile = (indexDirectory / (FormatHash(HashString(key)) + ".txt")).string();
+
+    std::string text;
+    if (std::ifstream in(indexFile); in >> text && text.size() == 16)
+    {
+        char *end = nullptr;
+        hash = std::strtoull(text.c_str(), &end, 16);
+        if (*end == '\0')
+        {
+            return true;
+        }
+    }
+
+    if (!HashFile(filename, hash))
+    {
+        return false;
+    }
+    std::filesystem::create_directories(indexDirectory, error);
+    WriteFileAtomically(indexFile, [&](const std::string &tempFile) {
+        std::ofstream out(tempFile, std::ios::trunc);
+        return static_cast<bool>(out << FormatHash(hash) << '\n');
+    });
+    return true;
+}
+
+void EnvironmentLoader::WorkerLoop()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true)
+    {
+        m_condition.wait(lock, [this] { return m_quit || m_request; });
+        if (m_quit)
+        {
+            break;
+        }
+
+        std::string filename = std::move(*m_request);
+        m_request.reset();
+        m_busy = true;
+        lock.unlock();
+
+        std::cout << "Preparing dome light " << filename << "..." << std::endl;
+        LoadedEnvironment environment = Prepare(filename);
+
+        lock.lock();
+        m_busy = false;
+
+        // Drop results that a newer request has superseded
+        if (!m_request && !m_quit)
+        {
+            m_result = std::move(environment);
+        }
+    }
+}
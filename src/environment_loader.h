@@ -0,0 +1,61 @@
+#pragma once
+
+// Standard Library Headers
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+
+// A dome light texture prepared for Storm
+struct LoadedEnvironment
+{
+    std::string sourceFile;  // The .exr/.hdr that was requested
+    std::string textureFile; // What the dome light should use: the cached reduction, or the source itself
+    int width = 0;
+    int height = 0;
+    bool fromCache = false;
+    double loadMs = 0.0;
+};
+
+// EnvironmentLoader Class
+//
+// Prepares dome light textures on a worker thread, so the render thread keeps drawing with the current lighting.
+// Storm decodes the dome light's texture on the render thread and prefilters it from its full resolution, which
+// stalls rendering for seconds with 8K HDRIs. The worker decodes the image once, reduces it to the resolution
+// the prefiltered maps need and writes that to a disk cache, keyed by a hash of the file's contents and the
+// output width. A small index maps path, size and modification time to that hash, so an unchanged file is not
+// read again to find its entry. Storm then only reads the small cached image, and switching back to an HDRI skips
+// the decode. Only the most recent request is kept.
+class EnvironmentLoader
+{
+  public:
+    // Constructor and Destructor
+    explicit EnvironmentLoader(const std::string &cacheDirectory);
+    ~EnvironmentLoader();
+
+    // Deleted Functions
+    EnvironmentLoader(const EnvironmentLoader &) = delete;
+    EnvironmentLoader &operator=(const EnvironmentLoader &) = delete;
+
+    // Public Interface
+    void Request(const std::string &filename);
+    bool Poll(LoadedEnvironment &environment);
+    bool IsLoading() const;
+
+  private:
+    LoadedEnvironment Prepare(const std::string &filename) const;
+    bool GetContentHash(const std::string &filename, uint64_t &hash) const;
+    void WorkerLoop();
+
+    std::string m_cacheDirectory;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_condition;
+    std::optional<std::string> m_request;
+    std::optional<LoadedEnvironment> m_result;
+    bool m_busy = false;
+    bool m_quit = false;
+    std::thread m_worker; // Last, so it starts after the state above is constructed
+};
@@ -0,0 +1,319 @@
+// Standard Library Headers
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+
+// Third-Party Library Headers
+#include <glad/glad.h>
+
+// Project Headers
+#include "frame_capture.h"
+#include "usd_headers.h"
+
+//----------------------------------------------------------------------
+// Internal Utility Functions
+
+namespace
+{
+
+constexpr auto kReleaseWait = std::chrono::milliseconds(10); // Bounds each wait for an encoder
+constexpr GLuint64 kFenceWaitNs = 10000000;                  // Bounds each wait for a readback
+
+bool IsExr(const std::string &filename)
+{
+    std::string extension = std::filesystem::path(filename).extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return extension == ".exr";
+}
+
+size_t GetPixelSize(bool exr)
+{
+    return exr ? 4 * sizeof(pxr::GfHalf) : 4;
+}
+
+} // namespace
+
+//----------------------------------------------------------------------
+// FrameCapture Class Implementation
+
+FrameCapture::FrameCapture(uint32_t ringSize) : m_slots(std::max<uint32_t>(1, ringSize))
+{
+    glGenFramebuffers(1, &m_readFramebuffer);
+    for (Slot &slot : m_slots)
+    {
+        glGenBuffers(1, &slot.buffer);
+    }
+
+    // PNG compression is the bottleneck of turntable capture; leave half the cores to Hydra
+    unsigned workerCount = std::max(1u, std::thread::hardware_concurrency() / 2);
+    for (unsigned i = 0; i < workerCount; ++i)
+    {
+        m_workers.emplace_back(&FrameCapture::WorkerLoop, this);
+    }
+}
+
+FrameCapture::~FrameCapture()
+{
+    Finish();
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_quit = true;
+    }
+    m_condition.notify_all();
+    for (std::thread &worker : m_workers)
+    {
+        worker.join();
+    }
+
+    for (Slot &slot : m_slots)
+    {
+        glDeleteBuffers(1, &slot.buffer);
+    }
+    glDeleteFramebuffers(1, &m_readFramebuffer);
+}
+
+bool FrameCapture::Capture(uint32_t texture, int width, int height, const std::string &filename)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto free = std::find_if(m_slots.begin(), m_slots.end(),
+                             [](const Slot &slot) { return slot.state == SlotState::Free; });
+    if (free == m_slots.end())
+    {
+        return false;
+    }
+
+    Slot &slot = *free;
+    slot.filename = filename;
+    slot.width = width;
+    slot.height = height;
+    slot.exr = IsExr(filename);
+    size_t size = static_cast<size_t>(width) * height * GetPixelSize(slot.exr);
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+    if (slot.capacity < size)
+    {
+        glBufferData(GL_PIXEL_PACK_BUFFER, static_cast<GLsizeiptr>(size), nullptr, GL_STREAM_READ);
+        slot.capacity = size;
+    }
+
+    // With a pack buffer bound, glReadPixels only queues the copy and returns
+    GLint previousFramebuffer = 0;
+    glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &previousFramebuffer);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, m_readFramebuffer);
+    glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture, 0);
+    glPixelStorei(GL_PACK_ALIGNMENT, 4);
+    glReadPixels(0, 0, width, height, GL_RGBA, slot.exr ? GL_HALF_FLOAT : GL_UNSIGNED_BYTE, nullptr);
+    glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, 0, 0);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, previousFramebuffer);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    slot.sequence = m_nextSequence++;
+    slot.state = SlotState::Reading;
+    return true;
+}
+
+void FrameCapture::Update()
+{
+    bool queued = false;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        // Readbacks finish in submission order, so stop at the first one that is still in flight
+        std::vector<Slot *> reading;
+        for (Slot &slot : m_slots)
+        {
+            if (slot.state == SlotState::Reading)
+            {
+                reading.push_back(&slot);
+            }
+        }
+        std::sort(reading.begin(), reading.end(),
+                  [](const Slot *a, const Slot *b) { return a->sequence < b->sequence; });
+        for (Slot *slot : reading)
+        {
+            GLsync fence = static_cast<GLsync>(slot->fence);
+            GLenum status = glClientWaitSync(fence, 0, 0);
+            if (status == GL_TIMEOUT_EXPIRED)
+            {
+                break;
+            }
+            glDeleteSync(fence);
+            slot->fence = nullptr;
+
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, slot->buffer);
+            size_t size = static_cast<size_t>(slot->width) * slot->height * GetPixelSize(slot->exr);
+            void *pixels = nullptr;
+            if (status != GL_WAIT_FAILED)
+            {
+                pixels = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, static_cast<GLsizeiptr>(size), GL_MAP_READ_BIT);
+            }
+            if (!pixels)
+            {
+                std::cerr << "FrameCapture: cannot read back " << slot->filename << std::endl;
+                slot->state = SlotState::Free;
+                ++m_failed;
+                continue;
+            }
+
+            // The encoder copies the rows out of the mapped buffer; Update() unmaps it once it is released
+            slot->state = SlotState::Mapped;
+            m_jobs.push_back({static_cast<size_t>(slot - m_slots.data()), static_cast<const uint8_t *>(pixels)});
+            queued = true;
+        }
+
+        for (Slot &slot : m_slots)
+        {
+            if (slot.state == SlotState::Released)
+            {
+                glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+                glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+                slot.state = SlotState::Free;
+            }
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    }
+
+    if (queued)
+    {
+        m_condition.notify_all();
+    }
+}
+
+void FrameCapture::WaitForSlot()
+{
+    Update();
+    while (!CanCapture())
+    {
+        WaitForProgress();
+        Update();
+    }
+}
+
+void FrameCapture::Finish()
+{
+    Update();
+    while (IsBusy())
+    {
+        WaitForProgress();
+        Update();
+    }
+}
+
+bool FrameCapture::CanCapture() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return std::any_of(m_slots.begin(), m_slots.end(), [](const Slot &slot) { return slot.state == SlotState::Free; });
+}
+
+bool FrameCapture::IsBusy() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_encoding > 0 || !m_jobs.empty() ||
+           std::any_of(m_slots.begin(), m_slots.end(), [](const Slot &slot) { return slot.state != SlotState::Free; });
+}
+
+size_t FrameCapture::GetWrittenCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_written;
+}
+
+size_t FrameCapture::GetFailedCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_failed;
+}
+
+bool FrameCapture::Encode(const Slot &slot, const std::vector<uint8_t> &pixels) const
+{
+    pxr::HioImageSharedPtr image = pxr::HioImage::OpenForWriting(slot.filename);
+    pxr::HioImage::StorageSpec spec;
+    spec.width = slot.width;
+    spec.height = slot.height;
+    spec.depth = 1;
+    spec.format = slot.exr ? pxr::HioFormatFloat16Vec4 : pxr::HioFormatUNorm8Vec4;
+    spec.data = const_cast<uint8_t *>(pixels.data());
+    if (!image || !image->Write(spec))
+    {
+        std::cerr << "FrameCapture: cannot write " << slot.filename << std::endl;
+        return false;
+    }
+    return true;
+}
+
+void FrameCapture::WaitForProgress()
+{
+    // Wait for the oldest readback if one is in flight, otherwise for an encoder to release its buffer
+    GLsync oldest = nullptr;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        uint64_t sequence = UINT64_MAX;
+        for (const Slot &slot : m_slots)
+        {
+            if (slot.state == SlotState::Reading && slot.sequence < sequence)
+            {
+                oldest = static_cast<GLsync>(slot.fence);
+                sequence = slot.sequence;
+            }
+        }
+        if (!oldest)
+        {
+            m_released.wait_for(lock, kReleaseWait);
+            return;
+        }
+    }
+
+    // Only Update(), on this thread, deletes fences
+    glClientWaitSync(oldest, GL_SYNC_FLUSH_COMMANDS_BIT, kFenceWaitNs);
+}
+
+void FrameCapture::WorkerLoop()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true)
+    {
+        m_condition.wait(lock, [this] { return m_quit || !m_jobs.empty(); });
+        if (m_jobs.empty())
+        {
+            break;
+        }
+
+        Job job = m_jobs.front();
+        m_jobs.pop_front();
+        Slot slot = m_slots[job.slot];
+        ++m_encoding;
+        lock.unlock();
+
+        // GL rows run bottom-up; images are written top-down
+        size_t rowSize = static_cast<size_t>(slot.width) * GetPixelSize(slot.exr);
+        std::vector<uint8_t> pixels(rowSize * slot.height);
+        for (int y = 0; y < slot.height; ++y)
+        {
+            std::memcpy(pixels.data() + rowSize * y, job.pixels + rowSize * (slot.height - 1 - y), rowSize);
+        }
+
+        lock.lock();
+        m_slots[job.slot].state = SlotState::Released;
+        lock.unlock();
+        m_released.notify_all();
+
+        bool written = Encode(slot, pixels);
+
+        lock.lock();
+        --m_encoding;
+        if (written)
+        {
+            ++m_written;
+        }
+        else
+        {
+            ++m_failed;
+        }
+        m_released.notify_all();
+    }
+}
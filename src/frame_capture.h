@@ -0,0 +1,100 @@
+#pragma once
+
+// Standard Library Headers
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// FrameCapture Class
+//
+// Writes rendered images to disk without stalling the render loop. Capture() only queues a glReadPixels of a
+// texture into one of a ring of pixel buffer objects and fences it; the copy runs on the GPU while the next
+// frames render. Update() maps the buffers whose fences have signaled and hands them to a pool of encoder
+// threads, which copy the rows out (flipping them to top-down), release the buffer and encode PNG or EXR
+// (chosen by the file extension) with HioImage. PNGs are written as 8-bit RGBA, EXRs as half-float RGBA.
+// All GL calls happen on the thread that owns the context; the destructor waits for queued images.
+class FrameCapture
+{
+  public:
+    // Constants
+    static constexpr uint32_t kDefaultRingSize = 3; // Readbacks in flight before Capture() refuses more
+
+    // Constructor and Destructor
+    explicit FrameCapture(uint32_t ringSize = kDefaultRingSize);
+    ~FrameCapture();
+
+    // Deleted Functions
+    FrameCapture(const FrameCapture &) = delete;
+    FrameCapture &operator=(const FrameCapture &) = delete;
+
+    /// Queues the readback of an RGBA GL texture to be written to `filename`. Returns false, without waiting, if
+    /// every buffer is still in flight or the encoders are too far behind; call Update() and try again later.
+    bool Capture(uint32_t texture, int width, int height, const std::string &filename);
+
+    /// Hands finished readbacks to the encoders and recycles released buffers. Never waits.
+    void Update();
+
+    /// Waits until Capture() can accept another image (for offline capture, which may not drop frames).
+    void WaitForSlot();
+
+    /// Waits until every queued image is written.
+    void Finish();
+
+    // Accessors
+    bool CanCapture() const;
+    bool IsBusy() const;
+    size_t GetWrittenCount() const;
+    size_t GetFailedCount() const;
+
+  private:
+    enum class SlotState
+    {
+        Free,    // Available for a readback
+        Reading, // glReadPixels queued; waiting for the fence
+        Mapped,  // Mapped and owned by an encoder until it has copied the pixels
+        Released // Copied; the buffer is unmapped on the GL thread by Update()
+    };
+
+    struct Slot
+    {
+        uint32_t buffer = 0;
+        size_t capacity = 0;
+        void *fence = nullptr; // GLsync of the readback
+        SlotState state = SlotState::Free;
+        uint64_t sequence = 0; // Submission order, so images are handed out in the order they were captured
+        std::string filename;
+        int width = 0;
+        int height = 0;
+        bool exr = false;
+    };
+
+    struct Job
+    {
+        size_t slot;
+        const uint8_t *pixels; // Mapped buffer, valid until the slot is released
+    };
+
+    void WaitForProgress();
+    void WorkerLoop();
+    bool Encode(const Slot &slot, const std::vector<uint8_t> &pixels) const;
+
+    uint32_t m_readFramebuffer = 0;
+    uint64_t m_nextSequence = 0;
+
+    // Shared with the encoders (slot states only change under the mutex once a slot is mapped)
+    mutable std::mutex m_mutex;
+    std::condition_variable m_condition; // Jobs queued or quitting
+    std::condition_variable m_released;  // A slot was released or an image was written
+    std::vector<Slot> m_slots;
+    std::deque<Job> m_jobs;
+    size_t m_encoding = 0; // Images being encoded
+    size_t m_written = 0;
+    size_t m_failed = 0;
+    bool m_quit = false;
+    std::vector<std::thread> m_workers; // Encoder pool
+};
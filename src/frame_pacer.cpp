@@ -0,0 +1,68 @@
+// Standard Library Headers
+#include <algorithm>
+#include <iostream>
+
+// Third-Party Library Headers
+#include <glad/glad.h>
+
+// Project Headers
+#include "frame_pacer.h"
+
+//----------------------------------------------------------------------
+// Internal Utility Functions
+
+namespace
+{
+
+constexpr GLuint64 kWaitTimeoutNs = 1000000000; // Waits are retried; this only bounds each call
+
+} // namespace
+
+//----------------------------------------------------------------------
+// FramePacer Class Implementation
+
+FramePacer::FramePacer(uint32_t latency) : m_fences(std::max<uint32_t>(1, latency), nullptr)
+{
+}
+
+FramePacer::~FramePacer()
+{
+    for (void *fence : m_fences)
+    {
+        if (fence)
+        {
+            glDeleteSync(static_cast<GLsync>(fence));
+        }
+    }
+}
+
+size_t FramePacer::BeginFrame()
+{
+    m_current = (m_current + 1) % m_fences.size();
+    GLsync fence = static_cast<GLsync>(m_fences[m_current]);
+    if (fence)
+    {
+        GLenum status;
+        do
+        {
+            status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, kWaitTimeoutNs);
+        } while (status == GL_TIMEOUT_EXPIRED);
+
+        if (status == GL_WAIT_FAILED)
+        {
+            std::cerr << "FramePacer: fence wait failed." << std::endl;
+        }
+        glDeleteSync(fence);
+        m_fences[m_current] = nullptr;
+    }
+    return m_current;
+}
+
+void FramePacer::EndFrame()
+{
+    if (m_fences[m_current])
+    {
+        glDeleteSync(static_cast<GLsync>(m_fences[m_current]));
+    }
+    m_fences[m_current] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
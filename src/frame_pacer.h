@@ -0,0 +1,38 @@
+#pragma once
+
+// Standard Library Headers
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// FramePacer Class
+//
+// Bounds how many frames the CPU may run ahead of the GPU with GL fence syncs. With a latency of n, frame N
+// waits for frame N - n to finish on the GPU before it starts, so Hydra syncs frame N while the GPU still
+// works on up to n - 1 earlier frames. A latency of 1 serializes the CPU and GPU completely. The slot returned
+// by BeginFrame() selects one of n render targets, so a frame never draws into one the GPU may still be
+// reading. Requires a current GL context for its whole lifetime.
+class FramePacer
+{
+  public:
+    // Constructor and Destructor
+    explicit FramePacer(uint32_t latency);
+    ~FramePacer();
+
+    // Deleted Functions
+    FramePacer(const FramePacer &) = delete;
+    FramePacer &operator=(const FramePacer &) = delete;
+
+    /// Waits for the frame that last used the next slot to finish on the GPU and returns that slot.
+    size_t BeginFrame();
+
+    /// Fences the GL commands submitted for the current frame.
+    void EndFrame();
+
+    // Accessors
+    uint32_t GetLatency() const noexcept { return static_cast<uint32_t>(m_fences.size()); }
+
+  private:
+    std::vector<void *> m_fences; // GLsync per slot; null if the slot has no frame in flight
+    size_t m_current = 0;
+};
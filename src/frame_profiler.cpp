@@ -0,0 +1,374 @@
+// Standard Library Headers
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+
+// Third-Party Library Headers
+#include <GLFW/glfw3.h>
+
+// Project Headers
+#include "frame_profiler.h"
+
+//----------------------------------------------------------------------
+// Internal Utility Functions
+
+namespace
+{
+
+constexpr uint32_t kGpuTrack = 0;
+
+// Small, stable per-thread ids for trace tracks (0 is reserved for the GPU)
+uint32_t CurrentThreadId()
+{
+    static std::atomic<uint32_t> s_nextId{1};
+    thread_local uint32_t id = s_nextId.fetch_add(1, std::memory_order_relaxed);
+    return id;
+}
+
+size_t BeginTimestamp(FramePhase phase)
+{
+    return 2 * static_cast<size_t>(phase);
+}
+
+size_t EndTimestamp(FramePhase phase)
+{
+    return 2 * static_cast<size_t>(phase) + 1;
+}
+
+} // namespace
+
+//----------------------------------------------------------------------
+// FrameProfiler::Scope Implementation
+
+FrameProfiler::Scope::Scope(FrameProfiler &profiler, FramePhase phase)
+    : m_profiler(profiler), m_phase(phase), m_frame(profiler.m_frameIndex), m_beginNs(profiler.Now())
+{
+    if (m_profiler.m_gpuTimer && m_profiler.m_inFrame)
+    {
+        m_profiler.m_gpuTimer->Timestamp(BeginTimestamp(m_phase));
+    }
+}
+
+FrameProfiler::Scope::~Scope()
+{
+    if (m_profiler.m_gpuTimer && m_profiler.m_inFrame)
+    {
+        m_profiler.m_gpuTimer->Timestamp(EndTimestamp(m_phase));
+    }
+
+    Event event;
+    event.frame = m_frame;
+    event.phase = m_phase;
+    event.thread = CurrentThreadId();
+    event.beginNs = m_beginNs;
+    event.endNs = m_profiler.Now();
+    m_profiler.m_events.Push(event);
+}
+
+//----------------------------------------------------------------------
+// FrameProfiler::EventRing Implementation
+
+FrameProfiler::EventRing::EventRing() : m_slots(new Slot[kEventCapacity])
+{
+}
+
+void FrameProfiler::EventRing::Push(const Event &event) noexcept
+{
+    uint64_t index = m_head.fetch_add(1, std::memory_order_relaxed);
+    Slot &slot = m_slots[index & (kEventCapacity - 1)];
+
+    // Odd sequence: slot is being written
+    slot.sequence.store(2 * index + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.event = event;
+    slot.sequence.store(2 * index + 2, std::memory_order_release);
+}
+
+void FrameProfiler::EventRing::Read(uint64_t &cursor, std::vector<Event> &events) const
+{
+    uint64_t head = m_head.load(std::memory_order_acquire);
+    if (head - cursor > kEventCapacity)
+    {
+        cursor = head - kEventCapacity; // Older events were overwritten
+    }
+
+    for (; cursor < head; ++cursor)
+    {
+        const Slot &slot = m_slots[cursor & (kEventCapacity - 1)];
+        const uint64_t expected = 2 * cursor + 2;
+
+        uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+        if (sequence < expected)
+        {
+            break; // A producer is still writing this slot; pick it up next time
+        }
+        if (sequence > expected)
+        {
+            continue; // Overwritten by a newer event
+        }
+
+        Event event = slot.event;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequence.load(std::memory_order_relaxed) == expected)
+        {
+            events.push_back(event);
+        }
+    }
+}
+
+void FrameProfiler::EventRing::ReadAll(std::vector<Event> &events) const
+{
+    uint64_t cursor = 0;
+    Read(cursor, events);
+}
+
+//----------------------------------------------------------------------
+// FrameProfiler Class Implementation
+
+FrameProfiler::FrameProfiler(size_t historySize) : m_historySize(historySize)
+{
+}
+
+FrameProfiler::~FrameProfiler() = default;
+
+void FrameProfiler::InitGpuTiming()
+{
+    m_gpuTimer = std::make_unique<GpuTimer>(2 * kFramePhaseCount);
+    m_gpuClockOffsetNs = static_cast<int64_t>(GpuTimer::GetCurrentTimeNs()) - Now();
+}
+
+void FrameProfiler::ReleaseGpuTiming()
+{
+    m_gpuTimer.reset();
+}
+
+void FrameProfiler::BeginFrame()
+{
+    int64_t now = Now();
+
+    FrameTiming timing;
+    timing.frame = m_frameIndex;
+    timing.frameMs = m_frameBeginNs >= 0 ? (now - m_frameBeginNs) * 1e-6 : 0.0;
+    m_history.push_back(timing);
+
+    m_frameBeginNs = now;
+    m_inFrame = true;
+
+    if (m_gpuTimer)
+    {
+        m_gpuTimer->Begin(m_frameIndex);
+    }
+}
+
+void FrameProfiler::EndFrame()
+{
+    if (!m_inFrame)
+    {
+        return;
+    }
+
+    if (m_gpuTimer)
+    {
+        m_gpuTimer->End();
+    }
+
+    FrameTiming &timing = m_history.back();
+    timing.cpuMs = (Now() - m_frameBeginNs) * 1e-6;
+    if (timing.frameMs == 0.0)
+    {
+        // First frame, or the first after an idle gap: there is no previous frame to measure from
+        timing.frameMs = timing.cpuMs;
+    }
+
+    m_titleIntervalFrames++;
+    m_titleIntervalWorstMs = std::max(m_titleIntervalWorstMs, timing.frameMs);
+
+    m_inFrame = false;
+    m_frameIndex++;
+
+    ProcessEvents();
+    ProcessGpuResults(/* wait = */ false);
+
+    while (m_history.size() > m_historySize)
+    {
+        m_history.pop_front();
+    }
+    while (m_gpuEvents.size() > kEventCapacity)
+    {
+        m_gpuEvents.pop_front();
+    }
+}
+
+void FrameProfiler::SetHistorySize(size_t historySize)
+{
+    m_historySize = historySize;
+}
+
+void FrameProfiler::Clear()
+{
+    ProcessEvents();
+    m_history.clear();
+    m_gpuEvents.clear();
+    m_frameBeginNs = -1;
+}
+
+void FrameProfiler::SkipIdleTime() noexcept
+{
+    m_frameBeginNs = -1;
+}
+
+void FrameProfiler::UpdateWindowTitle(GLFWwindow *window, double intervalSec)
+{
+    int64_t now = Now();
+    double elapsedSec = (now - m_titleIntervalBeginNs) * 1e-9;
+    if (elapsedSec < intervalSec)
+    {
+        return;
+    }
+
+    double fps = m_titleIntervalFrames / elapsedSec;
+    std::array<char, 128> buf;
+    std::snprintf(buf.data(), buf.size(), "USD Viewer — %.1f FPS (worst %.1f ms)", fps, m_titleIntervalWorstMs);
+    glfwSetWindowTitle(window, buf.data());
+
+    // Reset for next interval
+    m_titleIntervalBeginNs = now;
+    m_titleIntervalFrames = 0;
+    m_titleIntervalWorstMs = 0.0;
+}
+
+void FrameProfiler::Flush()
+{
+    ProcessEvents();
+    ProcessGpuResults(/* wait = */ true);
+}
+
+void FrameProfiler::PrintReport() const
+{
+    PrintFrameTimingSummary(GetHistory());
+}
+
+bool FrameProfiler::ExportChromeTrace(const std::string &filename) const
+{
+    std::ofstream file(filename);
+    if (!file)
+    {
+        std::cerr << "Failed to write trace: " << filename << std::endl;
+        return false;
+    }
+
+    std::vector<Event> events;
+    m_events.ReadAll(events);
+    events.insert(events.end(), m_gpuEvents.begin(), m_gpuEvents.end());
+
+    file << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n";
+    file << "  {\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": " << kGpuTrack
+         << ", \"args\": {\"name\": \"GPU\"}}";
+    for (const Event &event : events)
+    {
+        file << ",\n  {\"name\": \"" << ToString(event.phase) << "\", \"cat\": \""
+             << (event.thread == kGpuTrack ? "gpu" : "cpu") << "\", \"ph\": \"X\", \"pid\": 1, \"tid\": "
+             << event.thread << ", \"ts\": " << event.beginNs * 1e-3 << ", \"dur\": "
+             << (event.endNs - event.beginNs) * 1e-3 << ", \"args\": {\"frame\": " << event.frame << "}}";
+    }
+    file << "\n]}\n";
+
+    std::cout << "Wrote " << events.size() << " trace events to " << filename << std::endl;
+    return true;
+}
+
+std::vector<FrameTiming> FrameProfiler::GetHistory() const
+{
+    // The newest frame is still incomplete while it is being rendered
+    size_t count = m_history.size() - (m_inFrame && !m_history.empty() ? 1 : 0);
+    return std::vector<FrameTiming>(m_history.begin(), m_history.begin() + count);
+}
+
+double FrameProfiler::GetLastFrameCostMs() const noexcept
+{
+    // Skip the frame that is being rendered
+    size_t count = m_history.size() - (m_inFrame && !m_history.empty() ? 1 : 0);
+    double cpuMs = count > 0 ? m_history[count - 1].cpuMs : 0.0;
+    return std::max(cpuMs, m_lastGpuMs);
+}
+
+int64_t FrameProfiler::Now() const noexcept
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_epoch).count();
+}
+
+FrameTiming *FrameProfiler::FindFrame(uint32_t frame)
+{
+    if (m_history.empty() || frame < m_history.front().frame)
+    {
+        return nullptr;
+    }
+
+    size_t index = frame - m_history.front().frame;
+    return index < m_history.size() ? &m_history[index] : nullptr;
+}
+
+void FrameProfiler::ProcessEvents()
+{
+    std::vector<Event> events;
+    m_events.Read(m_eventCursor, events);
+
+    for (const Event &event : events)
+    {
+        if (FrameTiming *timing = FindFrame(event.frame))
+        {
+            timing->cpuPhaseMs[static_cast<size_t>(event.phase)] += (event.endNs - event.beginNs) * 1e-6;
+        }
+    }
+}
+
+void FrameProfiler::ProcessGpuResults(bool wait)
+{
+    if (!m_gpuTimer)
+    {
+        return;
+    }
+
+    std::vector<GpuTimer::Result> results;
+    m_gpuTimer->Collect(results, wait);
+
+    for (const GpuTimer::Result &result : results)
+    {
+        FrameTiming *timing = FindFrame(result.frame);
+        uint64_t first = 0, last = 0;
+
+        for (size_t p = 0; p < kFramePhaseCount; ++p)
+        {
+            FramePhase phase = static_cast<FramePhase>(p);
+            uint64_t begin = result.timestampsNs[BeginTimestamp(phase)];
+            uint64_t end = result.timestampsNs[EndTimestamp(phase)];
+            if (!begin || !end)
+            {
+                continue; // Phase was skipped this frame
+            }
+
+            first = first ? std::min(first, begin) : begin;
+            last = std::max(last, end);
+            if (timing)
+            {
+                timing->gpuPhaseMs[p] = (end - begin) * 1e-6;
+            }
+
+            Event event;
+            event.frame = result.frame;
+            event.phase = phase;
+            event.thread = kGpuTrack;
+            event.beginNs = static_cast<int64_t>(begin) - m_gpuClockOffsetNs;
+            event.endNs = static_cast<int64_t>(end) - m_gpuClockOffsetNs;
+            m_gpuEvents.push_back(event);
+        }
+
+        if (timing)
+        {
+            timing->gpuMs = (last - first) * 1e-6;
+        }
+        m_lastGpuMs = (last - first) * 1e-6;
+    }
+}
@@ -0,0 +1,146 @@
+#pragma once
+
+// Standard Library Headers
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Project Headers
+#include "frame_timings.h"
+#include "gpu_timer.h"
+
+// Forward Declarations
+struct GLFWwindow;
+
+// FrameProfiler Class
+//
+// Times each phase of a frame on the CPU (scoped timers written to a lock-free ring buffer) and on the GPU
+// (GL timestamp queries), keeps a history of per-frame records for percentile reports, and exports the
+// retained events as a Chrome trace (chrome://tracing, Perfetto).
+class FrameProfiler
+{
+  public:
+    // Constants
+    static constexpr size_t kDefaultHistorySize = 3600; // Frames kept for reports
+    static constexpr size_t kEventCapacity = 1 << 16;   // CPU events kept for trace export (power of two)
+
+    // Scoped CPU/GPU timer for one frame phase
+    class Scope
+    {
+      public:
+        Scope(FrameProfiler &profiler, FramePhase phase);
+        ~Scope();
+
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+
+      private:
+        FrameProfiler &m_profiler;
+        FramePhase m_phase;
+        uint32_t m_frame;
+        int64_t m_beginNs;
+    };
+
+    // Constructor and Destructor
+    explicit FrameProfiler(size_t historySize = kDefaultHistorySize);
+    ~FrameProfiler();
+
+    // Deleted Functions
+    FrameProfiler(const FrameProfiler &) = delete;
+    FrameProfiler &operator=(const FrameProfiler &) = delete;
+
+    // GPU timing needs a current GL context; release before the context is destroyed
+    void InitGpuTiming();
+    void ReleaseGpuTiming();
+
+    // Public Interface
+    void BeginFrame();
+    void EndFrame();
+    void SetHistorySize(size_t historySize);
+    void Clear();
+
+    /// Call while the loop sleeps between frames, so the next frame's time excludes the idle gap.
+    void SkipIdleTime() noexcept;
+
+    /// Updates the window title with FPS and the worst frame time every `intervalSec` seconds.
+    void UpdateWindowTitle(GLFWwindow *window, double intervalSec = 1.0);
+
+    /// Waits for outstanding GPU timings so the history is complete (e.g. before writing a report).
+    void Flush();
+
+    void PrintReport() const;
+    bool ExportChromeTrace(const std::string &filename) const;
+
+    // Accessors
+    std::vector<FrameTiming> GetHistory() const;
+    double GetLastFrameCostMs() const noexcept; // Larger of the last completed CPU and GPU frame times
+
+  private:
+    // A timed CPU or GPU interval
+    struct Event
+    {
+        uint32_t frame = 0;
+        FramePhase phase = FramePhase::Count;
+        uint32_t thread = 0; // 0 is the GPU track
+        int64_t beginNs = 0; // Relative to m_epoch
+        int64_t endNs = 0;
+    };
+
+    // Multi-producer ring buffer; each slot carries a sequence number so readers can detect torn or
+    // overwritten entries without locking.
+    class EventRing
+    {
+      public:
+        EventRing();
+        void Push(const Event &event) noexcept;
+
+        /// Appends events from `cursor` up to the newest completed one and advances `cursor`.
+        void Read(uint64_t &cursor, std::vector<Event> &events) const;
+
+        /// Appends all events still held in the ring.
+        void ReadAll(std::vector<Event> &events) const;
+
+      private:
+        struct Slot
+        {
+            std::atomic<uint64_t> sequence{0};
+            Event event;
+        };
+
+        std::unique_ptr<Slot[]> m_slots;
+        std::atomic<uint64_t> m_head{0};
+    };
+
+    int64_t Now() const noexcept;
+    FrameTiming *FindFrame(uint32_t frame);
+    void ProcessEvents();
+    void ProcessGpuResults(bool wait);
+
+    // Timing
+    std::chrono::steady_clock::time_point m_epoch{std::chrono::steady_clock::now()};
+    std::unique_ptr<GpuTimer> m_gpuTimer;
+    int64_t m_gpuClockOffsetNs = 0; // GPU timestamp minus CPU time since m_epoch
+
+    // Current Frame
+    uint32_t m_frameIndex = 0;
+    int64_t m_frameBeginNs = -1;
+    bool m_inFrame = false;
+    double m_lastGpuMs = 0.0; // Lags the CPU by the GPU timer latency
+
+    // Events and History
+    EventRing m_events;
+    uint64_t m_eventCursor = 0;
+    std::deque<Event> m_gpuEvents;
+    std::deque<FrameTiming> m_history;
+    size_t m_historySize;
+
+    // Window Title
+    int64_t m_titleIntervalBeginNs = 0;
+    uint32_t m_titleIntervalFrames = 0;
+    double m_titleIntervalWorstMs = 0.0;
+};
@@ -0,0 +1,177 @@
+// Standard Library Headers
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+
+// Project Headers
+#include "frame_timings.h"
+
+//----------------------------------------------------------------------
+// Internal Utility Functions
+
+namespace
+{
+
+template <typename Getter> void PrintPercentiles(const char *label, const std::vector<FrameTiming> &timings, Getter get)
+{
+    std::vector<double> values;
+    values.reserve(timings.size());
+    for (const FrameTiming &t : timings)
+    {
+        values.push_back(get(t));
+    }
+
+    double maxValue = *std::max_element(values.begin(), values.end());
+    std::printf("  %-6s p50 %8.2f   p95 %8.2f   p99 %8.2f   max %8.2f\n", label, Percentile(values, 50.0),
+                Percentile(values, 95.0), Percentile(values, 99.0), maxValue);
+}
+
+void WriteCsv(std::ostream &out, const std::vector<FrameTiming> &timings)
+{
+    out << "frame,frame_ms,cpu_ms,gpu_ms";
+    for (size_t i = 0; i < kFramePhaseCount; ++i)
+    {
+        out << ",cpu_" << ToString(static_cast<FramePhase>(i)) << "_ms";
+    }
+    for (size_t i = 0; i < kFramePhaseCount; ++i)
+    {
+        out << ",gpu_" << ToString(static_cast<FramePhase>(i)) << "_ms";
+    }
+    out << "\n";
+
+    for (const FrameTiming &t : timings)
+    {
+        out << t.frame << "," << t.frameMs << "," << t.cpuMs << "," << t.gpuMs;
+        for (double ms : t.cpuPhaseMs)
+        {
+            out << "," << ms;
+        }
+        for (double ms : t.gpuPhaseMs)
+        {
+            out << "," << ms;
+        }
+        out << "\n";
+    }
+}
+
+void WriteJsonPhases(std::ostream &out, const std::array<double, kFramePhaseCount> &phases)
+{
+    out << "{";
+    for (size_t i = 0; i < kFramePhaseCount; ++i)
+    {
+        out << (i ? ", " : "") << "\"" << ToString(static_cast<FramePhase>(i)) << "\": " << phases[i];
+    }
+    out << "}";
+}
+
+void WriteJson(std::ostream &out, const std::vector<FrameTiming> &timings)
+{
+    out << "{\n  \"frames\": [\n";
+    for (size_t i = 0; i < timings.size(); ++i)
+    {
+        const FrameTiming &t = timings[i];
+        out << "    {\"frame\": " << t.frame << ", \"frame_ms\": " << t.frameMs << ", \"cpu_ms\": " << t.cpuMs
+            << ", \"gpu_ms\": " << t.gpuMs << ", \"cpu_phases_ms\": ";
+        WriteJsonPhases(out, t.cpuPhaseMs);
+        out << ", \"gpu_phases_ms\": ";
+        WriteJsonPhases(out, t.gpuPhaseMs);
+        out << "}" << (i + 1 < timings.size() ? ",\n" : "\n");
+    }
+    out << "  ]\n}\n";
+}
+
+} // namespace
+
+//----------------------------------------------------------------------
+// Frame Timing Output
+
+double Percentile(std::vector<double> values, double p)
+{
+    if (values.empty())
+    {
+        return 0.0;
+    }
+    size_t rank = static_cast<size_t>(p / 100.0 * (values.size() - 1) + 0.5);
+    std::nth_element(values.begin(), values.begin() + rank, values.end());
+    return values[rank];
+}
+
+const char *ToString(FramePhase phase)
+{
+    switch (phase)
+    {
+    case FramePhase::SetCamera:
+        return "set_camera";
+    case FramePhase::Render:
+        return "render";
+    case FramePhase::Transfer:
+        return "transfer";
+    case FramePhase::Present:
+        return "present";
+    case FramePhase::Wait:
+        return "wait";
+    case FramePhase::Count:
+        break;
+    }
+    return "unknown";
+}
+
+bool WriteFrameTimings(const std::string &filename, const std::vector<FrameTiming> &timings)
+{
+    std::ofstream file(filename);
+    if (!file)
+    {
+        std::cerr << "Failed to write frame timings: " << filename << std::endl;
+        return false;
+    }
+
+    if (std::filesystem::path(filename).extension() == ".json")
+    {
+        WriteJson(file, timings);
+    }
+    else
+    {
+        WriteCsv(file, timings);
+    }
+
+    std::cout << "Wrote " << timings.size() << " frame timings to " << filename << std::endl;
+    return true;
+}
+
+void PrintFrameTimingSummary(const std::vector<FrameTiming> &timings, size_t worstFrameCount)
+{
+    if (timings.empty())
+    {
+        return;
+    }
+
+    std::printf("Frame timings (%zu frames, ms):\n", timings.size());
+    PrintPercentiles("frame", timings, [](const FrameTiming &t) { return t.frameMs; });
+    PrintPercentiles("cpu", timings, [](const FrameTiming &t) { return t.cpuMs; });
+    PrintPercentiles("gpu", timings, [](const FrameTiming &t) { return t.gpuMs; });
+
+    // Worst frames by frame time, with a per-phase CPU/GPU breakdown
+    std::vector<const FrameTiming *> worst;
+    for (const FrameTiming &t : timings)
+    {
+        worst.push_back(&t);
+    }
+    worstFrameCount = std::min(worstFrameCount, worst.size());
+    std::partial_sort(worst.begin(), worst.begin() + worstFrameCount, worst.end(),
+                      [](const FrameTiming *a, const FrameTiming *b) { return a->frameMs > b->frameMs; });
+
+    std::printf("Worst frames (cpu / gpu ms per phase):\n");
+    for (size_t i = 0; i < worstFrameCount; ++i)
+    {
+        const FrameTiming &t = *worst[i];
+        std::printf("  #%-6u %8.2f ms:", t.frame, t.frameMs);
+        for (size_t p = 0; p < kFramePhaseCount; ++p)
+        {
+            std::printf("  %s %.2f / %.2f", ToString(static_cast<FramePhase>(p)), t.cpuPhaseMs[p], t.gpuPhaseMs[p]);
+        }
+        std::printf("\n");
+    }
+    std::fflush(stdout);
+}
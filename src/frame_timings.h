@@ -0,0 +1,43 @@
+#pragma once
+
+// Standard Library Headers
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Phases of Application::ProcessFrame
+enum class FramePhase : uint8_t
+{
+    SetCamera, // Camera, viewport and AOV setup on the engine
+    Render,    // UsdImagingGLEngine::Render (Hydra sync and draw submission)
+    Transfer,  // HgiInterop::TransferToApp, or the blit of --direct-present
+    Present,   // Buffer swap
+    Wait,      // Waiting for the GPU to finish an earlier frame (--frame-latency)
+    Count
+};
+
+constexpr size_t kFramePhaseCount = static_cast<size_t>(FramePhase::Count);
+
+const char *ToString(FramePhase phase);
+
+// Per-frame timing record
+struct FrameTiming
+{
+    uint32_t frame = 0;
+    double frameMs = 0.0; // Time from the previous frame's start to this frame's start
+    double cpuMs = 0.0;   // Wall-clock time spent in ProcessFrame on the CPU
+    double gpuMs = 0.0;   // GPU time from the first to the last phase timestamp
+    std::array<double, kFramePhaseCount> cpuPhaseMs{};
+    std::array<double, kFramePhaseCount> gpuPhaseMs{};
+};
+
+// Nearest-rank percentile (0-100) of an unsorted sample set; 0 if it is empty.
+double Percentile(std::vector<double> values, double p);
+
+// Writes the timings as CSV, or as JSON if `filename` ends in ".json".
+bool WriteFrameTimings(const std::string &filename, const std::vector<FrameTiming> &timings);
+
+// Prints p50/p95/p99 frame, CPU and GPU times and a phase breakdown of the worst frames to stdout.
+void PrintFrameTimingSummary(const std::vector<FrameTiming> &timings, size_t worstFrameCount = 5);
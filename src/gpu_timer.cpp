@@ -0,0 +1,118 @@
+// Standard Library Headers
+#include <algorithm>
+
+// Third-Party Library Headers
+#include <glad/glad.h>
+
+// Project Headers
+#include "gpu_timer.h"
+
+//----------------------------------------------------------------------
+// GpuTimer Class Implementation
+
+GpuTimer::GpuTimer(size_t timestampCount)
+{
+    for (Slot &slot : m_slots)
+    {
+        slot.queries.resize(timestampCount);
+        slot.written.resize(timestampCount, false);
+        glGenQueries(static_cast<GLsizei>(timestampCount), slot.queries.data());
+    }
+}
+
+GpuTimer::~GpuTimer()
+{
+    for (Slot &slot : m_slots)
+    {
+        glDeleteQueries(static_cast<GLsizei>(slot.queries.size()), slot.queries.data());
+    }
+}
+
+void GpuTimer::Begin(uint32_t frame)
+{
+    Slot &slot = m_slots[m_current];
+    if (slot.pending)
+    {
+        // All slots are in flight; wait for the oldest one and keep its result for the next Collect()
+        Resolve(slot, /* wait = */ true, m_ready);
+    }
+
+    slot.frame = frame;
+    std::fill(slot.written.begin(), slot.written.end(), false);
+}
+
+void GpuTimer::Timestamp(size_t index)
+{
+    Slot &slot = m_slots[m_current];
+    if (index < slot.queries.size())
+    {
+        glQueryCounter(slot.queries[index], GL_TIMESTAMP);
+        slot.written[index] = true;
+    }
+}
+
+void GpuTimer::End()
+{
+    m_slots[m_current].pending = true;
+    m_current = (m_current + 1) % kLatency;
+}
+
+void GpuTimer::Collect(std::vector<Result> &results, bool wait)
+{
+    results.insert(results.end(), m_ready.begin(), m_ready.end());
+    m_ready.clear();
+
+    // Walk from the oldest slot to the newest so results stay in frame order
+    for (size_t i = 0; i < kLatency; ++i)
+    {
+        Slot &slot = m_slots[(m_current + i) % kLatency];
+        if (slot.pending && !Resolve(slot, wait, results))
+        {
+            break;
+        }
+    }
+}
+
+uint64_t GpuTimer::GetCurrentTimeNs()
+{
+    GLint64 now = 0;
+    glGetInteger64v(GL_TIMESTAMP, &now);
+    return static_cast<uint64_t>(now);
+}
+
+bool GpuTimer::Resolve(Slot &slot, bool wait, std::vector<Result> &results)
+{
+    if (!wait)
+    {
+        // Timestamps complete in order, so the last written one tells us whether the frame is done
+        for (size_t i = slot.queries.size(); i-- > 0;)
+        {
+            if (slot.written[i])
+            {
+                GLint available = 0;
+                glGetQueryObjectiv(slot.queries[i], GL_QUERY_RESULT_AVAILABLE, &available);
+                if (!available)
+                {
+                    return false;
+                }
+                break;
+            }
+        }
+    }
+
+    Result result;
+    result.frame = slot.frame;
+    result.timestampsNs.resize(slot.queries.size(), 0);
+    for (size_t i = 0; i < slot.queries.size(); ++i)
+    {
+        if (slot.written[i])
+        {
+            GLuint64 timestamp = 0;
+            glGetQueryObjectui64v(slot.queries[i], GL_QUERY_RESULT, &timestamp);
+            result.timestampsNs[i] = timestamp;
+        }
+    }
+    results.push_back(std::move(result));
+    slot.pending = false;
+    return true;
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+// Standard Library Headers
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// GpuTimer Class
+//
+// Records a fixed set of GL timestamps per frame. Results are read back a few frames late so that timing never
+// stalls the pipeline. Requires a current GL context for its whole lifetime.
+class GpuTimer
+{
+  public:
+    // Number of frames that may be in flight before Begin() has to wait for the oldest result
+    static constexpr size_t kLatency = 4;
+
+    // Resolved timestamps of one frame, in GPU nanoseconds (0 for timestamps that were not written)
+    struct Result
+    {
+        uint32_t frame = 0;
+        std::vector<uint64_t> timestampsNs;
+    };
+
+    // Constructor and Destructor
+    explicit GpuTimer(size_t timestampCount);
+    ~GpuTimer();
+
+    // Deleted Functions
+    GpuTimer(const GpuTimer &) = delete;
+    GpuTimer &operator=(const GpuTimer &) = delete;
+
+    // Public Interface
+    void Begin(uint32_t frame);
+    void Timestamp(size_t index);
+    void End();
+
+    /// Appends results for every finished frame in frame order. With `wait`, blocks until all frames are done.
+    void Collect(std::vector<Result> &results, bool wait = false);
+
+    /// Current GPU time in nanoseconds, for aligning GPU timestamps with CPU clocks.
+    static uint64_t GetCurrentTimeNs();
+
+  private:
+    struct Slot
+    {
+        std::vector<uint32_t> queries;
+        std::vector<bool> written;
+        uint32_t frame = 0;
+        bool pending = false;
+    };
+
+    bool Resolve(Slot &slot, bool wait, std::vector<Result> &results);
+
+    std::array<Slot, kLatency> m_slots;
+    std::vector<Result> m_ready; // Results resolved early by Begin()
+    size_t m_current = 0;
+};
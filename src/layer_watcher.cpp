@@ -0,0 +1,194 @@
+// Standard Library Headers
+#include <cerrno>
+#include <iostream>
+#include <iterator>
+#if defined(__linux__)
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+// Project Headers
+#include "layer_watcher.h"
+
+//----------------------------------------------------------------------
+// Internal Utility Functions
+
+namespace
+{
+
+constexpr std::chrono::milliseconds kDebounceTime(300); // Quiet time after the last change before reporting
+#if !defined(__linux__)
+constexpr std::chrono::milliseconds kPollInterval(500); // Modification time checks without inotify
+#endif
+
+std::string Normalize(const std::string &file)
+{
+    return std::filesystem::path(file).lexically_normal().string();
+}
+
+} // namespace
+
+//----------------------------------------------------------------------
+// LayerWatcher Class Implementation
+
+LayerWatcher::LayerWatcher()
+{
+#if defined(__linux__)
+    m_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (m_fd < 0)
+    {
+        std::cerr << "LayerWatcher: inotify_init1 failed (errno " << errno << "); files are not watched."
+                  << std::endl;
+    }
+#endif
+}
+
+LayerWatcher::~LayerWatcher()
+{
+#if defined(__linux__)
+    if (m_fd >= 0)
+    {
+        close(m_fd);
+    }
+#endif
+}
+
+void LayerWatcher::SetFiles(const std::vector<std::string> &files)
+{
+    m_files.clear();
+    for (const std::string &file : files)
+    {
+        m_files[Normalize(file)] = file;
+    }
+    for (auto it = m_changed.begin(); it != m_changed.end();)
+    {
+        it = m_files.count(*it) ? std::next(it) : m_changed.erase(it);
+    }
+
+#if defined(__linux__)
+    if (m_fd < 0)
+    {
+        return;
+    }
+
+    // Watch directories rather than files, so files replaced by a rename are still seen
+    std::set<std::string> directories;
+    for (const auto &[key, file] : m_files)
+    {
+        directories.insert(std::filesystem::path(key).parent_path().string());
+    }
+    for (auto it = m_directories.begin(); it != m_directories.end();)
+    {
+        if (directories.count(it->second))
+        {
+            directories.erase(it->second);
+            ++it;
+        }
+        else
+        {
+            inotify_rm_watch(m_fd, it->first);
+            it = m_directories.erase(it);
+        }
+    }
+    for (const std::string &directory : directories)
+    {
+        int wd = inotify_add_watch(m_fd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+        if (wd < 0)
+        {
+            std::cerr << "LayerWatcher: cannot watch " << directory << " (errno " << errno << ")" << std::endl;
+            continue;
+        }
+        m_directories[wd] = directory;
+    }
+#else
+    std::unordered_map<std::string, std::filesystem::file_time_type> fileTimes;
+    for (const auto &[key, file] : m_files)
+    {
+        auto it = m_fileTimes.find(key);
+        std::error_code error;
+        fileTimes[key] = it != m_fileTimes.end() ? it->second : std::filesystem::last_write_time(key, error);
+    }
+    m_fileTimes.swap(fileTimes);
+#endif
+}
+
+std::vector<std::string> LayerWatcher::Poll()
+{
+    ReadChanges();
+
+    std::vector<std::string> files;
+    if (m_changed.empty() || std::chrono::steady_clock::now() - m_lastChange < kDebounceTime)
+    {
+        return files;
+    }
+    for (const std::string &key : m_changed)
+    {
+        files.push_back(m_files[key]);
+    }
+    m_changed.clear();
+    return files;
+}
+
+void LayerWatcher::ReadChanges()
+{
+#if defined(__linux__)
+    if (m_fd < 0)
+    {
+        return;
+    }
+
+    alignas(inotify_event) char buffer[4096];
+    ssize_t length;
+    while ((length = read(m_fd, buffer, sizeof(buffer))) > 0)
+    {
+        for (char *ptr = buffer; ptr < buffer + length;)
+        {
+            const inotify_event *event = reinterpret_cast<const inotify_event *>(ptr);
+            ptr += sizeof(inotify_event) + event->len;
+
+            // Events were dropped; any file may have changed
+            if (event->mask & IN_Q_OVERFLOW)
+            {
+                for (const auto &[key, file] : m_files)
+                {
+                    MarkChanged(key);
+                }
+                continue;
+            }
+
+            auto directory = m_directories.find(event->wd);
+            if (event->len > 0 && directory != m_directories.end())
+            {
+                MarkChanged((std::filesystem::path(directory->second) / event->name).string());
+            }
+        }
+    }
+#else
+    auto now = std::chrono::steady_clock::now();
+    if (now - m_lastCheck < kPollInterval)
+    {
+        return;
+    }
+    m_lastCheck = now;
+
+    for (auto &[key, time] : m_fileTimes)
+    {
+        std::error_code error;
+        std::filesystem::file_time_type current = std::filesystem::last_write_time(key, error);
+        if (!error && current != time)
+        {
+            time = current;
+            MarkChanged(key);
+        }
+    }
+#endif
+}
+
+void LayerWatcher::MarkChanged(const std::string &key)
+{
+    if (m_files.count(key))
+    {
+        m_changed.insert(key);
+        m_lastChange = std::chrono::steady_clock::now();
+    }
+}
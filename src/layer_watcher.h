@@ -0,0 +1,52 @@
+#pragma once
+
+// Standard Library Headers
+#include <chrono>
+#include <filesystem>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// LayerWatcher Class
+//
+// Watches the files of a stage's layers and reports the ones that changed on disk once saving has settled, so a
+// burst of saves (or an application writing several layers) results in a single reload. On Linux this uses
+// inotify on the directories of the files, which also sees editors that save to a temporary file and rename it
+// over the original; elsewhere the files' modification times are polled.
+class LayerWatcher
+{
+  public:
+    // Constructor and Destructor
+    LayerWatcher();
+    ~LayerWatcher();
+
+    // Deleted Functions
+    LayerWatcher(const LayerWatcher &) = delete;
+    LayerWatcher &operator=(const LayerWatcher &) = delete;
+
+    /// Replaces the watched files. Changes still pending for files that stay watched are kept.
+    void SetFiles(const std::vector<std::string> &files);
+
+    /// Returns the changed files (as passed to SetFiles) once none has changed for the debounce interval.
+    std::vector<std::string> Poll();
+
+    /// True while changes wait for the debounce interval to pass.
+    bool HasPendingChanges() const { return !m_changed.empty(); }
+
+  private:
+    void ReadChanges();
+    void MarkChanged(const std::string &key);
+
+    std::unordered_map<std::string, std::string> m_files; // Normalized path -> path as passed to SetFiles
+    std::set<std::string> m_changed;                      // Normalized paths
+    std::chrono::steady_clock::time_point m_lastChange;
+
+#if defined(__linux__)
+    int m_fd = -1;
+    std::unordered_map<int, std::string> m_directories; // inotify watch descriptor -> directory
+#else
+    std::unordered_map<std::string, std::filesystem::file_time_type> m_fileTimes;
+    std::chrono::steady_clock::time_point m_lastCheck;
+#endif
+};
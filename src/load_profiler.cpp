@@ -0,0 +1,213 @@
+// Standard Library Headers
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+
+// Project Headers
+#include "load_profiler.h"
+#include "memory_usage.h"
+#include "usd_headers.h"
+
+//----------------------------------------------------------------------
+// Internal Utility Functions
+
+namespace
+{
+
+double ToMB(size_t bytes)
+{
+    return bytes / (1024.0 * 1024.0);
+}
+
+double ElapsedMs(std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end)
+{
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+} // namespace
+
+//----------------------------------------------------------------------
+// LoadPhaseScope Class Implementation
+
+LoadPhaseScope::LoadPhaseScope(std::vector<LoadPhase> *phases, const char *name) : m_phases(phases)
+{
+    if (!m_phases)
+    {
+        return;
+    }
+
+    m_phase.name = name;
+    m_phase.thread = std::this_thread::get_id();
+    m_phase.begin = std::chrono::steady_clock::now();
+    pxr::TraceCollector::GetInstance().BeginEvent(pxr::TraceDynamicKey(m_phase.name));
+}
+
+LoadPhaseScope::~LoadPhaseScope()
+{
+    if (!m_phases)
+    {
+        return;
+    }
+
+    pxr::TraceCollector::GetInstance().EndEvent(pxr::TraceDynamicKey(m_phase.name));
+    m_phase.end = std::chrono::steady_clock::now();
+    m_phase.rssBytes = GetCurrentRssBytes();
+    m_phase.peakRssBytes = GetPeakRssBytes();
+    m_phases->push_back(std::move(m_phase));
+}
+
+//----------------------------------------------------------------------
+// LoadProfiler Class Implementation
+
+LoadProfiler::LoadProfiler(const std::string &reportFile, const std::string &traceFile)
+    : m_reportFile(reportFile), m_traceFile(traceFile)
+{
+}
+
+void LoadProfiler::Begin(const std::string &filename)
+{
+    m_active = true;
+    m_filename = filename;
+    m_mainThread = std::this_thread::get_id();
+    m_phases.clear();
+    m_peakIsPerLoad = ResetPeakRss();
+    m_beginRssBytes = GetCurrentRssBytes();
+    m_begin = std::chrono::steady_clock::now();
+
+    // Tracing every scope in the library has a cost, so it only runs while a load is profiled
+    if (!m_traceFile.empty())
+    {
+        pxr::TraceCollector::GetInstance().Clear();
+        pxr::TraceReporter::GetGlobalReporter()->ClearTree();
+        pxr::TraceCollector::GetInstance().SetEnabled(true);
+    }
+}
+
+void LoadProfiler::AddPhases(const std::vector<LoadPhase> &phases)
+{
+    if (m_active)
+    {
+        m_phases.insert(m_phases.end(), phases.begin(), phases.end());
+    }
+}
+
+std::vector<LoadPhase> *LoadProfiler::GetPhases()
+{
+    return m_active ? &m_phases : nullptr;
+}
+
+bool LoadProfiler::End()
+{
+    if (!m_active)
+    {
+        return true;
+    }
+    m_active = false;
+
+    // Phases from the loader thread were added after the fact
+    std::stable_sort(m_phases.begin(), m_phases.end(),
+                     [](const LoadPhase &a, const LoadPhase &b) { return a.begin < b.begin; });
+
+    bool success = true;
+    if (!m_traceFile.empty())
+    {
+        pxr::TraceCollector::GetInstance().SetEnabled(false);
+        success &= WriteTrace();
+    }
+
+    PrintTable();
+    if (!m_reportFile.empty())
+    {
+        success &= WriteReport();
+    }
+    return success;
+}
+
+void LoadProfiler::PrintTable() const
+{
+    auto end = m_phases.empty() ? m_begin : m_phases.back().end;
+
+    std::printf("Load phases for %s (rss at start %.1f MB):\n", m_filename.c_str(), ToMB(m_beginRssBytes));
+    std::printf("  %-20s %7s %10s %10s %10s %10s\n", "phase", "thread", "start ms", "time ms", "rss MB", "peak MB");
+    for (const LoadPhase &phase : m_phases)
+    {
+        std::printf("  %-20s %7s %10.1f %10.1f %10.1f %10.1f\n", phase.name.c_str(),
+                    phase.thread == m_mainThread ? "main" : "loader", ElapsedMs(m_begin, phase.begin),
+                    ElapsedMs(phase.begin, phase.end), ToMB(phase.rssBytes), ToMB(phase.peakRssBytes));
+    }
+    std::printf("  %-20s %7s %10s %10.1f %10.1f %10.1f\n", "total", "", "", ElapsedMs(m_begin, end),
+                ToMB(GetCurrentRssBytes()), ToMB(GetPeakRssBytes()));
+    std::printf("  main thread blocked for %.1f ms\n", GetMainThreadMs());
+    if (!m_peakIsPerLoad)
+    {
+        std::printf("  (peak is the process peak; this platform cannot reset it per load)\n");
+    }
+    std::fflush(stdout);
+}
+
+double LoadProfiler::GetMainThreadMs() const
+{
+    double ms = 0.0;
+    for (const LoadPhase &phase : m_phases)
+    {
+        if (phase.thread == m_mainThread)
+        {
+            ms += ElapsedMs(phase.begin, phase.end);
+        }
+    }
+    return ms;
+}
+
+bool LoadProfiler::WriteReport() const
+{
+    std::ofstream file(m_reportFile);
+    if (!file)
+    {
+        std::cerr << "Failed to write load report: " << m_reportFile << std::endl;
+        return false;
+    }
+
+    auto end = m_phases.empty() ? m_begin : m_phases.back().end;
+    pxr::JsWriter writer(file, pxr::JsWriter::Style::Pretty);
+    writer.BeginObject();
+    writer.WriteKeyValue("scene", m_filename);
+    writer.WriteKeyValue("total_ms", ElapsedMs(m_begin, end));
+    writer.WriteKeyValue("main_thread_ms", GetMainThreadMs());
+    writer.WriteKeyValue("begin_rss_mb", ToMB(m_beginRssBytes));
+    writer.WriteKeyValue("peak_rss_mb", ToMB(GetPeakRssBytes()));
+    writer.WriteKeyValue("peak_is_per_load", m_peakIsPerLoad);
+    writer.WriteKey("phases");
+    writer.BeginArray();
+    for (const LoadPhase &phase : m_phases)
+    {
+        writer.BeginObject();
+        writer.WriteKeyValue("name", phase.name);
+        writer.WriteKeyValue("start_ms", ElapsedMs(m_begin, phase.begin));
+        writer.WriteKeyValue("time_ms", ElapsedMs(phase.begin, phase.end));
+        writer.WriteKeyValue("thread", phase.thread == m_mainThread ? "main" : "loader");
+        writer.WriteKeyValue("rss_mb", ToMB(phase.rssBytes));
+        writer.WriteKeyValue("peak_rss_mb", ToMB(phase.peakRssBytes));
+        writer.EndObject();
+    }
+    writer.EndArray();
+    writer.EndObject();
+    file << "\n";
+
+    std::cout << "Wrote load report to " << m_reportFile << std::endl;
+    return true;
+}
+
+bool LoadProfiler::WriteTrace() const
+{
+    std::ofstream file(m_traceFile);
+    if (!file)
+    {
+        std::cerr << "Failed to write load trace: " << m_traceFile << std::endl;
+        return false;
+    }
+
+    pxr::TraceReporter::GetGlobalReporter()->ReportChromeTracing(file);
+    std::cout << "Wrote load trace to " << m_traceFile << std::endl;
+    return true;
+}
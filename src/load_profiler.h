@@ -0,0 +1,83 @@
+#pragma once
+
+// Standard Library Headers
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <vector>
+
+// A named step of loading a scene, with the process memory at its end
+struct LoadPhase
+{
+    std::string name;
+    std::chrono::steady_clock::time_point begin;
+    std::chrono::steady_clock::time_point end;
+    std::thread::id thread; // Phases on the thread that called LoadProfiler::Begin() stall rendering
+    size_t rssBytes = 0;     // Resident set size when the phase finished
+    size_t peakRssBytes = 0; // Peak resident set size when the phase finished
+};
+
+// Times one load phase and appends it to `phases`, on whichever thread the phase runs. While OpenUSD tracing is
+// enabled the phase is also a TraceCollector event, so library scopes nest under it in the trace.
+class LoadPhaseScope
+{
+  public:
+    LoadPhaseScope(std::vector<LoadPhase> *phases, const char *name); // Does nothing if `phases` is null
+    ~LoadPhaseScope();
+
+    LoadPhaseScope(const LoadPhaseScope &) = delete;
+    LoadPhaseScope &operator=(const LoadPhaseScope &) = delete;
+
+  private:
+    std::vector<LoadPhase> *m_phases; // Non-owning pointer, may be null
+    LoadPhase m_phase;
+};
+
+// LoadProfiler Class
+//
+// Collects the phases of one scene load, from parsing and composing on the loader thread through applying the
+// scene and rendering its first frame on the main thread, and prints them as a table of times and memory.
+// The table can also be written as JSON, and the load recorded with OpenUSD's TraceCollector as a Chrome
+// trace that includes the library's own scopes (layer reads, composition, Hydra sync).
+class LoadProfiler
+{
+  public:
+    // Constructor
+    LoadProfiler(const std::string &reportFile, const std::string &traceFile); // Either may be empty
+
+    // Deleted Functions
+    LoadProfiler(const LoadProfiler &) = delete;
+    LoadProfiler &operator=(const LoadProfiler &) = delete;
+
+    /// Starts profiling a load of `filename`, discarding an unfinished one. Call it on the render thread; the
+    /// time spent in phases on that thread is reported as the time rendering was blocked.
+    void Begin(const std::string &filename);
+
+    /// Adds phases that ran elsewhere (e.g. on the loader thread).
+    void AddPhases(const std::vector<LoadPhase> &phases);
+
+    /// Phases of the load in progress, for LoadPhaseScope; null when no load is being profiled.
+    std::vector<LoadPhase> *GetPhases();
+
+    /// Reports the load and writes the output files. Returns false if a file could not be written.
+    bool End();
+
+  private:
+    void PrintTable() const;
+    double GetMainThreadMs() const;
+    bool WriteReport() const;
+    bool WriteTrace() const;
+
+    std::string m_reportFile;
+    std::string m_traceFile;
+
+    // Current Load
+    bool m_active = false;
+    std::string m_filename;
+    std::chrono::steady_clock::time_point m_begin;
+    std::thread::id m_mainThread;
+    size_t m_beginRssBytes = 0;
+    bool m_peakIsPerLoad = false; // The OS peak was reset at Begin(), so it covers this load only
+    std::vector<LoadPhase> m_phases;
+};
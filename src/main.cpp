@@ -5,22 +5,46 @@
 
 // Project Headers
 #include "application.h"
+#include "memory_resolver.h"
+#include "options.h"
+#include "prim_outline.h"
 
 // Application default dimensions
 constexpr uint32_t kDefaultWidth = 800;
 constexpr uint32_t kDefaultHeight = 600;
 
 // Main function
-int main()
+int main(int argc, char **argv)
 {
+    // Parse command-line options
+    Options options;
+    if (!ParseOptions(argc, argv, options))
+    {
+        return EXIT_FAILURE;
+    }
+    if (options.help)
+    {
+        return EXIT_SUCCESS;
+    }
+
+    // Before anything else uses USD, so the resolver is found when OpenUSD discovers resolvers
+    RegisterMemoryResolver();
+
+    // Listing prims needs neither a window nor the scene
+    if (!options.outlinePath.empty())
+    {
+        return PrintPrimOutline(options.sceneFile, options.outlinePath, options.outlineDepth) ? EXIT_SUCCESS
+                                                                                              : EXIT_FAILURE;
+    }
+
     // Create and run the application
-    Application app(kDefaultWidth, kDefaultHeight);
-    app.Run();
+    Application app(kDefaultWidth, kDefaultHeight, options);
+    bool success = app.Run();
 
     // Keep runtime alive for Emscripten builds
 #if defined(__EMSCRIPTEN__)
     emscripten_exit_with_live_runtime();
 #endif
 
-    return EXIT_SUCCESS;
+    return success ? EXIT_SUCCESS : EXIT_FAILURE;
 }
@@ -0,0 +1,225 @@
+// Standard Library Headers
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <mutex>
+#include <unordered_map>
+
+// Project Headers
+#include "memory_resolver.h"
+#include "usd_headers.h"
+
+//----------------------------------------------------------------------
+// Internal Utility Functions
+
+namespace
+{
+
+constexpr const char *kScheme = "mem:";
+constexpr const char *kPluginFolder = "usdViewerPlugins/"; // Next to the executable, holds plugInfo.json
+
+struct MemoryBuffer
+{
+    std::shared_ptr<const char> data;
+    size_t size = 0;
+    double timestamp = 0.0; // Registration order, so a re-registered name never looks unchanged
+    std::string folder;     // Folder the bytes came from, for relative paths; empty if they have no file
+};
+
+std::mutex s_buffersMutex;
+std::unordered_map<std::string, MemoryBuffer> s_buffers;
+std::atomic<uint64_t> s_nextId{1};
+
+bool FindBuffer(const std::string &uri, MemoryBuffer &buffer)
+{
+    std::lock_guard<std::mutex> lock(s_buffersMutex);
+    auto it = s_buffers.find(uri);
+    if (it == s_buffers.end())
+    {
+        return false;
+    }
+    buffer = it->second;
+    return true;
+}
+
+} // namespace
+
+//----------------------------------------------------------------------
+// MemoryAsset Class
+//
+// An ArAsset over a registered buffer. GetBuffer() shares the buffer itself, so nothing is copied up front.
+class MemoryAsset : public pxr::ArAsset
+{
+  public:
+    explicit MemoryAsset(const MemoryBuffer &buffer) : m_buffer(buffer)
+    {
+    }
+
+    size_t GetSize() const override
+    {
+        return m_buffer.size;
+    }
+
+    std::shared_ptr<const char> GetBuffer() const override
+    {
+        return m_buffer.data;
+    }
+
+    size_t Read(void *buffer, size_t count, size_t offset) const override
+    {
+        if (offset >= m_buffer.size)
+        {
+            return 0;
+        }
+        count = std::min(count, m_buffer.size - offset);
+        std::memcpy(buffer, m_buffer.data.get() + offset, count);
+        return count;
+    }
+
+    std::pair<FILE *, size_t> GetFileUnsafe() const override
+    {
+        return {nullptr, 0};
+    }
+
+  private:
+    MemoryBuffer m_buffer;
+};
+
+//----------------------------------------------------------------------
+// MemoryResolver Class
+//
+// Resolves "mem:" URIs to registered buffers. Relative paths are anchored next to the URI that refers to them.
+class MemoryResolver : public pxr::ArResolver
+{
+  protected:
+    std::string _CreateIdentifier(const std::string &assetPath,
+                                  const pxr::ArResolvedPath &anchorAssetPath) const override
+    {
+        // Other URIs and absolute paths are left to their own resolvers
+        const std::string &anchor = anchorAssetPath.GetPathString();
+        if (IsMemoryAssetPath(assetPath) || !IsMemoryAssetPath(anchor) ||
+            std::filesystem::path(assetPath).has_root_path())
+        {
+            return assetPath;
+        }
+
+        // Bytes that came from a file find their relative references next to that file on disk
+        MemoryBuffer buffer;
+        if (FindBuffer(anchor, buffer) && !buffer.folder.empty())
+        {
+            return (std::filesystem::path(buffer.folder) / assetPath).lexically_normal().generic_string();
+        }
+
+        std::string relative = assetPath.compare(0, 2, "./") == 0 ? assetPath.substr(2) : assetPath;
+        return anchor.substr(0, anchor.rfind('/') + 1) + relative;
+    }
+
+    std::string _CreateIdentifierForNewAsset(const std::string &assetPath,
+                                             const pxr::ArResolvedPath &anchorAssetPath) const override
+    {
+        return _CreateIdentifier(assetPath, anchorAssetPath);
+    }
+
+    pxr::ArResolvedPath _Resolve(const std::string &assetPath) const override
+    {
+        MemoryBuffer buffer;
+        return FindBuffer(assetPath, buffer) ? pxr::ArResolvedPath(assetPath) : pxr::ArResolvedPath();
+    }
+
+    pxr::ArResolvedPath _ResolveForNewAsset(const std::string &assetPath) const override
+    {
+        return pxr::ArResolvedPath(); // Buffers are read-only
+    }
+
+    std::shared_ptr<pxr::ArAsset> _OpenAsset(const pxr::ArResolvedPath &resolvedPath) const override
+    {
+        MemoryBuffer buffer;
+        if (!FindBuffer(resolvedPath.GetPathString(), buffer))
+        {
+            return nullptr;
+        }
+        return std::make_shared<MemoryAsset>(buffer);
+    }
+
+    std::shared_ptr<pxr::ArWritableAsset> _OpenAssetForWrite(const pxr::ArResolvedPath &resolvedPath,
+                                                             WriteMode writeMode) const override
+    {
+        return nullptr;
+    }
+
+    pxr::ArTimestamp _GetModificationTimestamp(const std::string &assetPath,
+                                               const pxr::ArResolvedPath &resolvedPath) const override
+    {
+        MemoryBuffer buffer;
+        return FindBuffer(resolvedPath.GetPathString(), buffer) ? pxr::ArTimestamp(buffer.timestamp)
+                                                                : pxr::ArTimestamp();
+    }
+};
+
+PXR_NAMESPACE_OPEN_SCOPE
+AR_DEFINE_RESOLVER(::MemoryResolver, ArResolver);
+PXR_NAMESPACE_CLOSE_SCOPE
+
+//----------------------------------------------------------------------
+// In-Memory Assets
+
+bool RegisterMemoryResolver()
+{
+    // plugInfo.json declares the resolver type and its URI scheme; the type itself is defined above
+    std::filesystem::path executableFolder = std::filesystem::path(pxr::ArchGetExecutablePath()).parent_path();
+    std::string plugInfoPath = (executableFolder / kPluginFolder).string();
+    if (pxr::PlugRegistry::GetInstance().RegisterPlugins(plugInfoPath).empty())
+    {
+        std::cerr << "Failed to register the in-memory asset resolver from " << plugInfoPath << std::endl;
+        return false;
+    }
+    return true;
+}
+
+std::string RegisterMemoryAsset(const std::string &name, std::shared_ptr<const char> data, size_t size)
+{
+    uint64_t id = s_nextId++;
+    std::filesystem::path path(name);
+    std::string uri = std::string(kScheme) + "//" + std::to_string(id) + "/" + path.filename().string();
+
+    MemoryBuffer buffer{std::move(data), size, static_cast<double>(id)};
+    if (path.has_parent_path())
+    {
+        std::error_code error;
+        buffer.folder = std::filesystem::absolute(path.parent_path(), error).generic_string();
+    }
+
+    std::lock_guard<std::mutex> lock(s_buffersMutex);
+    s_buffers[uri] = std::move(buffer);
+    return uri;
+}
+
+std::string RegisterMappedFile(const std::string &filename)
+{
+    std::string error;
+    pxr::ArchConstFileMapping mapping = pxr::ArchMapFileReadOnly(filename, &error);
+    if (!mapping)
+    {
+        std::cerr << "Failed to map " << filename << ": " << error << std::endl;
+        return std::string();
+    }
+
+    // The buffer owns the mapping; it is unmapped when the last layer reading from it is closed
+    size_t size = pxr::ArchGetFileMappingLength(mapping);
+    auto owner = std::make_shared<pxr::ArchConstFileMapping>(std::move(mapping));
+    std::shared_ptr<const char> data(owner, owner->get());
+    return RegisterMemoryAsset(filename, std::move(data), size);
+}
+
+void UnregisterMemoryAsset(const std::string &uri)
+{
+    std::lock_guard<std::mutex> lock(s_buffersMutex);
+    s_buffers.erase(uri);
+}
+
+bool IsMemoryAssetPath(const std::string &path)
+{
+    return path.compare(0, std::strlen(kScheme), kScheme) == 0;
+}
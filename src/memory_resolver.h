@@ -0,0 +1,31 @@
+#pragma once
+
+// Standard Library Headers
+#include <cstddef>
+#include <memory>
+#include <string>
+
+// In-Memory Assets
+//
+// Lets stages be opened straight from bytes that are already in memory, through an ArResolver for "mem:" URIs.
+// A registered buffer is handed to USD as an ArAsset without copying it: usdz packages are read in place
+// through ArAsset::GetBuffer(), and usdc layers read the byte ranges they need from it on demand. Layers keep
+// the buffer alive for as long as they read from it. Relative paths inside a buffer resolve next to the file it
+// was named after, or if that name has no folder, against other registered buffers only (so such buffers should
+// be self-contained, e.g. a .usdz package or a flattened layer).
+
+// Makes the "mem:" resolver known to OpenUSD. Call once at startup, before anything else uses USD.
+bool RegisterMemoryResolver();
+
+// Registers `size` bytes at `data` and returns the URI to open them with, e.g. "mem://1/scene.usdc". The file
+// name of `name` is kept in the URI so USD picks the file format from its extension.
+std::string RegisterMemoryAsset(const std::string &name, std::shared_ptr<const char> data, size_t size);
+
+// Maps a local file read-only and registers the mapping. Returns an empty string if the file cannot be mapped.
+std::string RegisterMappedFile(const std::string &filename);
+
+// Forgets a registered buffer; layers that are still open keep reading from it until they are closed.
+void UnregisterMemoryAsset(const std::string &uri);
+
+// True for URIs returned by RegisterMemoryAsset and RegisterMappedFile.
+bool IsMemoryAssetPath(const std::string &path);
@@ -0,0 +1,97 @@
+// Platform Headers
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+
+#include <psapi.h>
+#elif defined(__APPLE__)
+#include <mach/mach.h>
+#else
+#include <fstream>
+#include <string>
+#endif
+
+// Project Headers
+#include "memory_usage.h"
+
+//----------------------------------------------------------------------
+// Internal Utility Functions
+
+namespace
+{
+
+#if !defined(_WIN32) && !defined(__APPLE__)
+// Reads a "<field>: <n> kB" line from /proc/self/status
+size_t ReadProcStatusBytes(const char *field)
+{
+    std::ifstream status("/proc/self/status");
+    std::string name;
+    while (status >> name)
+    {
+        if (name == field)
+        {
+            size_t kilobytes = 0;
+            status >> kilobytes;
+            return kilobytes * 1024;
+        }
+        status.ignore(256, '\n');
+    }
+    return 0;
+}
+#endif
+
+} // namespace
+
+//----------------------------------------------------------------------
+// Process Memory Usage
+
+size_t GetCurrentRssBytes()
+{
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters{};
+    return GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)) ? counters.WorkingSetSize : 0;
+#elif defined(__APPLE__)
+    mach_task_basic_info_data_t info{};
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+    if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&info), &count) !=
+        KERN_SUCCESS)
+    {
+        return 0;
+    }
+    return info.resident_size;
+#else
+    return ReadProcStatusBytes("VmRSS:");
+#endif
+}
+
+size_t GetPeakRssBytes()
+{
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters{};
+    return GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)) ? counters.PeakWorkingSetSize : 0;
+#elif defined(__APPLE__)
+    mach_task_basic_info_data_t info{};
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+    if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&info), &count) !=
+        KERN_SUCCESS)
+    {
+        return 0;
+    }
+    return info.resident_size_max;
+#else
+    return ReadProcStatusBytes("VmHWM:");
+#endif
+}
+
+bool ResetPeakRss()
+{
+#if defined(_WIN32) || defined(__APPLE__)
+    return false;
+#else
+    // Writing 5 to clear_refs resets VmHWM to the current RSS (Linux 4.0 and later)
+    std::ofstream clearRefs("/proc/self/clear_refs");
+    return static_cast<bool>(clearRefs << "5" << std::flush);
+#endif
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+// Standard Library Headers
+#include <cstddef>
+
+// Process Memory Usage
+//
+// Resident set size of the whole process, as reported by the OS (0 where it cannot be queried).
+
+// Current resident set size in bytes.
+size_t GetCurrentRssBytes();
+
+// Largest resident set size since the process started, or since the last successful ResetPeakRss().
+size_t GetPeakRssBytes();
+
+// Restarts peak tracking at the current RSS. Only Linux supports this; returns false elsewhere.
+bool ResetPeakRss();
@@ -0,0 +1,527 @@
+// Standard Library Headers
+#include <cctype>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+// Project Headers
+#include "options.h"
+
+//----------------------------------------------------------------------
+// Internal Utility Functions
+
+namespace
+{
+
+void PrintUsage(const char *program)
+{
+    std::cout << "Usage: " << program << " [options] [scene.usd]\n"
+              << "\n"
+              << "Options:\n"
+              << "  --open-from <source>    Open scenes from a file (default), an in-memory buffer or an mmap\n"
+              << "                          (file, buffer or mmap)\n"
+              << "  --scene-cache-disk-mb <n>\n"
+              << "                          Keep recently loaded scenes open while their layer files total up to\n"
+              << "                          n MB on disk (default: 1024, 0 = off)\n"
+              << "  --load-report <file>    Write the phase times and memory of each scene load to a .json file\n"
+              << "  --load-trace <file>     Record each scene load with the OpenUSD tracer as a Chrome trace\n"
+              << "  --mask <path>           Compose only this prim and its descendants (repeatable)\n"
+              << "  --isolate <path>        Render only this prim and its descendants\n"
+              << "  --exclude <path>        Don't render this prim and its descendants (repeatable)\n"
+              << "  --outline <path>        Print the prims below <path> ('/' for the root) without loading the scene\n"
+              << "  --outline-depth <n>     Levels of prims printed by --outline (default: 2)\n"
+              << "  --auto-instance         Instance prims that reference the same asset (in the session layer)\n"
+              << "  --threads <n>           Limit OpenUSD and TBB to n worker threads (default: 0, all cores)\n"
+              << "  --render-threads <n>    Reserve n of the threads for Hydra sync; loads use the rest (default: 0)\n"
+              << "  --scene-stats <file>    Write the prim counts and performance hazards of each scene to .json\n"
+              << "  --shader-cache <dir>    Keep compiled shaders in <dir> (default: per-user cache directory)\n"
+              << "  --no-shader-cache       Compile every shader on each run\n"
+              << "  --warm-shader-cache     Compile the scene's shaders into the cache and exit (implies --headless)\n"
+              << "  --no-watch              Don't reload the scene's layers when they change on disk\n"
+              << "  --continuous            Redraw continuously instead of only when the view or scene changes\n"
+              << "  --max-fps <n>           Cap the interactive frame rate (default: 0, uncapped)\n"
+              << "  --frame-budget-ms <ms>  Lower the resolution while navigating to hold this frame time\n"
+              << "                          (default: 33.3, 0 disables)\n"
+              << "  --frame-latency <n>     Let Hydra sync up to n frames ahead of the GPU, paced with fences\n"
+              << "                          (default: 0, up to the driver; 1 serializes CPU and GPU)\n"
+              << "  --direct-present        Blit the rendered image to the window instead of compositing it twice\n"
+              << "  --adaptive-lod          Draw proxy-purpose geometry while navigating or over the frame budget\n"
+              << "  --play                  Play animated scenes from the start (headless: one frame per render)\n"
+              << "  --prefetch-frames <n>   Frames of animation to read ahead during playback (default: 24, 0 = off)\n"
+              << "  --headless              Render offscreen without a window and exit after the benchmark\n"
+              << "  --headless-api <api>    Offscreen GL context: egl (surfaceless, default) or osmesa\n"
+              << "  --frames <n>            Number of frames to render in headless mode (default: 300)\n"
+              << "  --camera-path <file>    Camera path to play back (headless) or record to with 'R'\n"
+              << "  --timings <file>        Write per-frame CPU/GPU timings to a .csv or .json file\n"
+              << "  --trace <file>          Write a Chrome trace of the headless frames\n"
+              << "  --switch-scene <file>   After the headless benchmark, time switching to <file> and back\n"
+              << "  --batch <manifest>      Benchmark every stage of a JSON manifest (implies --headless)\n"
+              << "  --baseline <file>       Compare the batch results to a baseline and fail on regressions\n"
+              << "  --batch-results <file>  Write the batch results as JSON (usable as a baseline)\n"
+              << "  --batch-stage <name>    Run only this stage of the manifest, merging its results into the file\n"
+              << "  --scaling               Time the load and first frame at 1, 2, 4 ... threads (implies --headless)\n"
+              << "  --capture <dir>         Save F12 screenshots to <dir>; with --headless, render a turntable there\n"
+              << "  --capture-format <fmt>  Image format of captured frames: png (default) or exr\n"
+              << "  --capture-frames <n>    Turntable frames (default: 0, one full turn)\n"
+              << "  --capture-size <WxH>    Turntable resolution, e.g. 3840x2160 (default: window size)\n"
+              << "  --present-benchmark     Compare interop and direct presentation at 1080p and 4K\n"
+              << "                          (implies --headless)\n"
+              << "  --stream-payloads       Load payloads on demand by camera visibility and screen size\n"
+              << "  --stream-budget-mb <n>  Memory budget for streamed payloads in MB (default: 2048)\n"
+              << "  --stream-min-size <f>   Minimum screen size (fraction of viewport height) to load (default: 0.01)\n"
+              << "  --help                  Show this message\n";
+}
+
+// Returns the value following argv[i], advancing i. Prints an error if the value is missing.
+const char *NextValue(int argc, char **argv, int &i)
+{
+    if (i + 1 >= argc)
+    {
+        std::cerr << "Missing value for option: " << argv[i] << std::endl;
+        return nullptr;
+    }
+    return argv[++i];
+}
+
+// Reads the decimal number at the start of `text`, setting `end` past it. Unlike strtoul alone, this rejects a sign
+// (strtoul takes "-1" as ULONG_MAX) and values that don't fit 32 bits.
+bool ParseDigits(const char *text, const char *&end, uint32_t &value)
+{
+    end = text;
+    if (!std::isdigit(static_cast<unsigned char>(text[0])))
+    {
+        return false;
+    }
+
+    char *digitsEnd = nullptr;
+    errno = 0;
+    unsigned long long parsed = std::strtoull(text, &digitsEnd, 10);
+    end = digitsEnd;
+    if (errno == ERANGE || parsed > UINT32_MAX)
+    {
+        return false;
+    }
+    value = static_cast<uint32_t>(parsed);
+    return true;
+}
+
+bool ParseUInt(const char *text, uint32_t &value)
+{
+    const char *end = nullptr;
+    uint32_t parsed = 0;
+    if (!ParseDigits(text, end, parsed) || *end != '\0')
+    {
+        std::cerr << "Invalid number: " << text << std::endl;
+        return false;
+    }
+    value = parsed;
+    return true;
+}
+
+// Parses "<width>x<height>"
+bool ParseSize(const char *text, uint32_t &width, uint32_t &height)
+{
+    const char *end = nullptr;
+    uint32_t parsedWidth = 0, parsedHeight = 0;
+    if (!ParseDigits(text, end, parsedWidth) || *end != 'x' || !ParseDigits(end + 1, end, parsedHeight) ||
+        *end != '\0' || parsedWidth == 0 || parsedHeight == 0)
+    {
+        std::cerr << "Invalid size: " << text << " (expected <width>x<height>)" << std::endl;
+        return false;
+    }
+    width = parsedWidth;
+    height = parsedHeight;
+    return true;
+}
+
+bool ParseFloat(const char *text, float &value)
+{
+    char *end = nullptr;
+    float parsed = std::strtof(text, &end);
+    if (end == text || *end != '\0')
+    {
+        std::cerr << "Invalid number: " << text << std::endl;
+        return false;
+    }
+    value = parsed;
+    return true;
+}
+
+} // namespace
+
+//----------------------------------------------------------------------
+// Options Parsing
+
+bool ParseSceneSource(const std::string &value, SceneSource &source)
+{
+    if (value == "file")
+    {
+        source = SceneSource::File;
+    }
+    else if (value == "buffer")
+    {
+        source = SceneSource::Buffer;
+    }
+    else if (value == "mmap")
+    {
+        source = SceneSource::MappedFile;
+    }
+    else
+    {
+        std::cerr << "Invalid scene source: " << value << " (expected file, buffer or mmap)" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool ParseOptions(int argc, char **argv, Options &options)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const char *arg = argv[i];
+        const char *value = nullptr;
+
+        if (std::strcmp(arg, "--help") == 0 || std::strcmp(arg, "-h") == 0)
+        {
+            PrintUsage(argv[0]);
+            options.help = true;
+            return true;
+        }
+        else if (std::strcmp(arg, "--open-from") == 0)
+        {
+            if (!(value = NextValue(argc, argv, i)) || !ParseSceneSource(value, options.sceneSource))
+            {
+                return false;
+            }
+        }
+        else if (std::strcmp(arg, "--scene-cache-disk-mb") == 0)
+        {
+            if (!(value = NextValue(argc, argv, i)) || !ParseUInt(value, options.sceneCacheDiskMB))
+            {
+                return false;
+            }
+        }
+        else if (std::strcmp(arg, "--load-report") == 0)
+        {
+            if (!(value = NextValue(argc, argv, i)))
+            {
+                return false;
+            }
+            options.loadReportFile = value;
+        }
+        else if (std::strcmp(arg, "--load-trace") == 0)
+        {
+            if (!(value = NextValue(argc, argv, i)))
+            {
+                return false;
+            }
+            options.loadTraceFile = value;
+        }
+        else if (std::strcmp(arg, "--scene-stats") == 0)
+        {
+            if (!(value = NextValue(argc, argv, i)))
+            {
+                return false;
+            }
+            options.sceneStatsFile = value;
+        }
+        else if (std::strcmp(arg, "--mask") == 0)
+        {
+            if (!(value = NextValue(argc, argv, i)))
+            {
+                return false;
+            }
+            options.populationMask.push_back(value);
+        }
+        else if (std::strcmp(arg, "--isolate") == 0)
+        {
+            if (!(value = NextValue(argc, argv, i)))
+            {
+                return false;
+            }
+            options.isolatePath = value;
+        }
+        else if (std::strcmp(arg, "--exclude") == 0)
+        {
+            if (!(value = NextValue(argc, argv, i)))
+            {
+                return false;
+            }
+            options.excludedPaths.push_back(value);
+        }
+        else if (std::strcmp(arg, "--outline") == 0)
+        {
+            if (!(value = NextValue(argc, argv, i)))
+            {
+                return false;
+            }
+            options.outlinePath = value;
+        }
+        else if (std::strcmp(arg, "--outline-depth") == 0)
+        {
+            if (!(value = NextValue(argc, argv, i)) || !ParseUInt(value, options.outlineDepth))
+            {
+                return false;
+            }
+        }
+        else if (std::strcmp(arg, "--auto-instance") == 0)
+        {
+            options.autoInstance = true;
+        }
+        else if (std::strcmp(arg, "--threads") == 0)
+        {
+            if (!(value = NextValue(argc, argv, i)) || !ParseUInt(value, options.threads))
+            {
+                return false;
+            }
+        }
+        else if (std::strcmp(arg, "--render-threads") == 0)
+        {
+            if (!(value = NextValue(argc, argv, i)) || !ParseUInt(value, options.renderThreads))
+            {
+                return false;
+            }
+        }
+        else if (std::strcmp(arg, "--shader-cache") == 0)
+        {
+            if (!(value = NextValue(argc, argv, i)))
+            {
+                return false;
+            }
+            options.shaderCacheDir = value;
+        }
+        else if (std::strcmp(arg, "--no-shader-cache") == 0)
+        {
+            options.shaderCache = false;
+        }
+        else if (std::strcmp(arg, "--warm-shader-cache") == 0)
+        {
+            options.warmShaderCache = true;
+            options.headless = true;
+            options.frameCount = 1;
+        }
+        else if (std::strcmp(arg, "--no-watch") == 0)
+        {
+            options.watchLayers = false;
+        }
+        else if (std::strcmp(arg, "--continuous") == 0)
+        {
+            options.continuousRedraw = true;
+        }
+        else if (std::strcmp(arg, "--max-fps") == 0)
+        {
+            if (!(value = NextValue(argc, argv, i)) || !ParseUInt(value, options.maxFps))
+            {
+                return false;
+            }
+        }
+        else if (std::strcmp(arg, "--frame-budget-ms") == 0)
+        {
+            if (!(value = NextValue(argc, argv, i)) || !ParseFloat(value, options.frameBudgetMs))
+            {
+                return false;
+            }
+        }
+        else if (std::strcmp(arg, "--frame-latency") == 0)
+        {
+            if (!(value = NextValue(argc, argv, i)) || !ParseUInt(value, options.frameLatency))
+            {
+                return false;
+            }
+        }
+        else if (std::strcmp(arg, "--direct-present") == 0)
+        {
+            options.directPresent = true;
+        }
+        else if (std::strcmp(arg, "--adaptive-lod") == 0)
+        {
+            options.adaptiveLod = true;
+        }
+        else if (std::strcmp(arg, "--play") == 0)
+        {
+            options.play = true;
+        }
+        else if (std::strcmp(arg, "--prefetch-frames") == 0)
+        {
+            if (!(value = NextValue(argc, argv, i)) || !ParseUInt(value, options.prefetchFrames))
+            {
+                return false;
+            }
+        }
+        else if (std::strcmp(arg, "--headless") == 0)
+        {
+            options.headless = true;
+        }
+        else if (std::strcmp(arg, "--headless-api") == 0)
+        {
+            if (!(value = NextValue(argc, argv, i)))
+            {
+                return false;
+            }
+            if (std::strcmp(value, "egl") == 0)
+            {
+                options.headlessApi = HeadlessApi::EGL;
+            }
+            else if (std::strcmp(value, "osmesa") == 0)
+            {
+                options.headlessApi = HeadlessApi::OSMesa;
+            }
+            else
+            {
+                std::cerr << "Unknown headless API: " << value << std::endl;
+                return false;
+            }
+        }
+        else if (std::strcmp(arg, "--frames") == 0)
+        {
+            if (!(value = NextValue(argc, argv, i)) || !ParseUInt(value, options.frameCount))
+            {
+                return false;
+            }
+        }
+        else if (std::strcmp(arg, "--camera-path") == 0)
+        {
+            if (!(value = NextValue(argc, argv, i)))
+            {
+                return false;
+            }
+            options.cameraPathFile = value;
+        }
+        else if (std::strcmp(arg, "--timings") == 0)
+        {
+            if (!(value = NextValue(argc, argv, i)))
+            {
+                return false;
+            }
+            options.timingsFile = value;
+        }
+        else if (std::strcmp(arg, "--trace") == 0)
+        {
+            if (!(value = NextValue(argc, argv, i)))
+            {
+                return false;
+            }
+            options.traceFile = value;
+        }
+        else if (std::strcmp(arg, "--switch-scene") == 0)
+        {
+            if (!(value = NextValue(argc, argv, i)))
+            {
+                return false;
+            }
+            options.switchSceneFile = value;
+        }
+        else if (std::strcmp(arg, "--batch") == 0)
+        {
+            if (!(value = NextValue(argc, argv, i)))
+            {
+                return false;
+            }
+            options.batchManifestFile = value;
+            options.headless = true;
+        }
+        else if (std::strcmp(arg, "--baseline") == 0)
+        {
+            if (!(value = NextValue(argc, argv, i)))
+            {
+                return false;
+            }
+            options.baselineFile = value;
+        }
+        else if (std::strcmp(arg, "--batch-results") == 0)
+        {
+            if (!(value = NextValue(argc, argv, i)))
+            {
+                return false;
+            }
+            options.batchResultsFile = value;
+        }
+        else if (std::strcmp(arg, "--batch-stage") == 0)
+        {
+            if (!(value = NextValue(argc, argv, i)))
+            {
+                return false;
+            }
+            options.batchStage = value;
+        }
+        else if (std::strcmp(arg, "--scaling") == 0)
+        {
+            options.scalingBenchmark = true;
+            options.headless = true;
+        }
+        else if (std::strcmp(arg, "--capture") == 0)
+        {
+            if (!(value = NextValue(argc, argv, i)))
+            {
+                return false;
+            }
+            options.captureDir = value;
+        }
+        else if (std::strcmp(arg, "--capture-format") == 0)
+        {
+            if (!(value = NextValue(argc, argv, i)))
+            {
+                return false;
+            }
+            if (std::strcmp(value, "png") != 0 && std::strcmp(value, "exr") != 0)
+            {
+                std::cerr << "Invalid capture format: " << value << " (expected png or exr)" << std::endl;
+                return false;
+            }
+            options.captureFormat = value;
+        }
+        else if (std::strcmp(arg, "--capture-frames") == 0)
+        {
+            if (!(value = NextValue(argc, argv, i)) || !ParseUInt(value, options.captureFrames))
+            {
+                return false;
+            }
+        }
+        else if (std::strcmp(arg, "--capture-size") == 0)
+        {
+            if (!(value = NextValue(argc, argv, i)) ||
+                !ParseSize(value, options.captureWidth, options.captureHeight))
+            {
+                return false;
+            }
+        }
+        else if (std::strcmp(arg, "--present-benchmark") == 0)
+        {
+            options.presentBenchmark = true;
+            options.headless = true;
+        }
+        else if (std::strcmp(arg, "--stream-payloads") == 0)
+        {
+            options.streamPayloads = true;
+        }
+        else if (std::strcmp(arg, "--stream-budget-mb") == 0)
+        {
+            if (!(value = NextValue(argc, argv, i)) || !ParseUInt(value, options.streamBudgetMB))
+            {
+                return false;
+            }
+        }
+        else if (std::strcmp(arg, "--stream-min-size") == 0)
+        {
+            if (!(value = NextValue(argc, argv, i)) || !ParseFloat(value, options.streamMinScreenSize))
+            {
+                return false;
+            }
+        }
+        else if (arg[0] == '-')
+        {
+            std::cerr << "Unknown option: " << arg << std::endl;
+            PrintUsage(argv[0]);
+            options.help = true;
+            return true;
+        }
+        else
+        {
+            options.sceneFile = arg;
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,116 @@
+#pragma once
+
+// Standard Library Headers
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Headless GL Context API
+enum class HeadlessApi
+{
+    EGL,   // EGL surfaceless context (Mesa llvmpipe, GPU drivers with EGL_MESA_platform_surfaceless)
+    OSMesa // Off-screen Mesa software rasterizer
+};
+
+// Where scenes are read from
+enum class SceneSource
+{
+    File,      // UsdStage::Open on the path
+    Buffer,    // Read into memory first (like bytes from an asset server cache), then opened in place
+    MappedFile // Mapped read-only and opened through the in-memory resolver
+};
+
+// Options Struct
+struct Options
+{
+    bool help = false; // --help was given and the usage printed; parsing stopped there
+
+    // Scene
+    std::string sceneFile = "assets/Kitchen_set/Kitchen_set.usd";
+
+    SceneSource sceneSource = SceneSource::File;
+
+    // Partial Loading (prim paths in the scene's namespace, as listed by --outline)
+    std::vector<std::string> populationMask; // Only these prims (and their ancestors) are composed (empty = all)
+    std::string isolatePath;                 // Hydra only populates this subtree (empty = the whole stage)
+    std::vector<std::string> excludedPaths;  // Hydra skips these subtrees
+    std::string outlinePath;                 // Print the prim outline below this path and exit
+    uint32_t outlineDepth = 2;               // Levels of the outline to print
+
+    // Scene Cache
+    uint32_t sceneCacheDiskMB = 1024; // On-disk size of the layers of recently loaded scenes kept open (0 disables)
+
+    // Load Profiling
+    std::string loadReportFile; // Phase times and memory of the latest scene load (.json)
+    std::string loadTraceFile;  // OpenUSD trace of the latest scene load, Chrome trace format (.json)
+
+    // Scene Statistics (always printed after a load)
+    std::string sceneStatsFile; // Prim counts and performance hazards of the latest scene (.json)
+
+    // Auto Instancing
+    bool autoInstance = false; // Mark prims with identical references instanceable in the session layer
+
+    // Threading
+    uint32_t threads = 0;       // Worker threads for OpenUSD and TBB (0 = all cores)
+    uint32_t renderThreads = 0; // Threads reserved for Hydra sync; background loads get the rest (0 = shared)
+
+    // Shader Cache
+    bool shaderCache = true;      // Keep compiled GL programs on disk between runs
+    std::string shaderCacheDir;   // Where to keep them (empty = per-user cache directory)
+    bool warmShaderCache = false; // Load the scene and render one frame headless, only to fill the cache
+
+    // Live Reload
+    bool watchLayers = true; // Reload layers that change on disk while the viewer runs
+
+    // Interactive Redraw
+    bool continuousRedraw = false; // Render every loop iteration instead of only when something changed
+    uint32_t maxFps = 0;           // Frame cap (0 = uncapped)
+    float frameBudgetMs = 33.3f;   // Frame time to hold while navigating by lowering the resolution (0 = off)
+    bool adaptiveLod = false;      // Draw proxy purpose instead of render purpose while the camera moves
+    uint32_t frameLatency = 0;     // Frames the CPU may run ahead of the GPU (0 = up to the driver, 1 = serialized)
+    bool directPresent = false;    // Blit the color AOV to the framebuffer instead of compositing it with HgiInterop
+
+    // Animation
+    bool play = false;            // Start playback on load (headless: advance one frame per rendered frame)
+    uint32_t prefetchFrames = 24; // Frames of time samples whose pages are read ahead of playback (0 = off)
+
+    // Headless Benchmark
+    bool headless = false;
+    HeadlessApi headlessApi = HeadlessApi::EGL;
+    uint32_t frameCount = 300;
+    std::string cameraPathFile;  // Recorded camera path (played back headless, recorded to interactively)
+    std::string timingsFile;     // Per-frame timings output (.csv or .json)
+    std::string traceFile;       // Chrome trace output (.json)
+    std::string switchSceneFile; // Scene to switch back and forth to after the benchmark, to time scene switches
+
+    // Batch Benchmark (headless; see batch_benchmark.h for the file formats)
+    std::string batchManifestFile; // Stages, camera paths and frame counts to benchmark in one run
+    std::string baselineFile;      // Results of an earlier run to compare against; regressions fail the run
+    std::string batchResultsFile;  // Where to write this run's results (usable as a later baseline)
+    std::string batchStage;        // Run only this stage, so each stage can get a process of its own
+
+    // Scaling Benchmark (headless)
+    bool scalingBenchmark = false; // Time loading and the first frame of the scene at 1, 2, 4 ... threads
+
+    // Capture (F12 saves a screenshot; headless runs with a capture directory render a turntable into it)
+    std::string captureDir;            // Where screenshots and turntable frames go (empty = screenshots to ".")
+    std::string captureFormat = "png"; // png (8-bit) or exr (half float)
+    uint32_t captureFrames = 0;        // Turntable frames (0 = one full turn of the orbit)
+    uint32_t captureWidth = 0;         // Turntable resolution (0 = window size)
+    uint32_t captureHeight = 0;
+
+    // Presentation Benchmark (headless)
+    bool presentBenchmark = false; // Compare interop and direct presentation at 1080p and 4K
+
+    // Payload Streaming
+    bool streamPayloads = false;       // Open with payloads unloaded and load them by visibility and screen size
+    uint32_t streamBudgetMB = 2048;    // Estimated memory budget for loaded payloads
+    float streamMinScreenSize = 0.01f; // Payloads smaller than this fraction of the viewport height stay unloaded
+};
+
+// Parses "file", "buffer" or "mmap". Prints an error and returns false for anything else.
+bool ParseSceneSource(const std::string &value, SceneSource &source);
+
+// Parses the command line into `options`. Returns false for bad arguments; after --help it prints the usage, sets
+// `options.help` and returns true.
+bool ParseOptions(int argc, char **argv, Options &options);
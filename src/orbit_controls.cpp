@@ -3,6 +3,7 @@
 
 // Project Headers
 #include "camera.h"
+#include "camera_path.h"
 #include "orbit_controls.h"
 
 //----------------------------------------------------------------------
@@ -16,6 +17,27 @@ OrbitControls::OrbitControls(GLFWwindow *window, Camera *camera) : m_window(wind
     glfwSetMouseButtonCallback(window, MouseButtonCallback);
 }
 
+void OrbitControls::SetRecorder(CameraPath *recorder) noexcept
+{
+    m_recorder = recorder;
+}
+
+bool OrbitControls::IsInteracting() const noexcept
+{
+    return m_mouseTumble || m_mousePan || glfwGetTime() - m_lastScrollTime < kScrollIdleSeconds;
+}
+
+bool OrbitControls::TakeClick(glm::vec2 &position) noexcept
+{
+    if (!m_clicked)
+    {
+        return false;
+    }
+    m_clicked = false;
+    position = m_mousePressPos;
+    return true;
+}
+
 void OrbitControls::CursorPositionCallback(GLFWwindow *window, double xpos, double ypos) noexcept
 {
     auto controls = static_cast<OrbitControls *>(glfwGetWindowUserPointer(window));
@@ -34,10 +56,18 @@ void OrbitControls::CursorPositionCallback(GLFWwindow *window, double xpos, doub
         if (controls->m_mouseTumble)
         {
             controls->m_camera->Tumble(xrel, yrel);
+            if (controls->m_recorder)
+            {
+                controls->m_recorder->Record(CameraPath::Operation::Tumble, xrel, yrel);
+            }
         }
         else if (controls->m_mousePan)
         {
             controls->m_camera->Pan(xrel, yrel);
+            if (controls->m_recorder)
+            {
+                controls->m_recorder->Record(CameraPath::Operation::Pan, xrel, yrel);
+            }
         }
     }
 }
@@ -50,7 +80,13 @@ void OrbitControls::ScrollCallback(GLFWwindow *window, double xoffset, double yo
         return;
     }
 
-    controls->m_camera->Zoom(0, static_cast<int>(yoffset * kZoomSensitivity));
+    int zoom = static_cast<int>(yoffset * kZoomSensitivity);
+    controls->m_camera->Zoom(0, zoom);
+    controls->m_lastScrollTime = glfwGetTime();
+    if (controls->m_recorder)
+    {
+        controls->m_recorder->Record(CameraPath::Operation::Zoom, 0, zoom);
+    }
 }
 
 void OrbitControls::MouseButtonCallback(GLFWwindow *window, int button, int action, int mods) noexcept
@@ -70,6 +106,7 @@ void OrbitControls::MouseButtonCallback(GLFWwindow *window, int button, int acti
         switch (action)
         {
         case GLFW_PRESS:
+            controls->m_mousePressPos = controls->m_mouseLastPos;
             if (mods & GLFW_MOD_SHIFT)
             {
                 controls->m_mousePan = true;
@@ -80,6 +117,12 @@ void OrbitControls::MouseButtonCallback(GLFWwindow *window, int button, int acti
             }
             break;
         case GLFW_RELEASE:
+            // A press and release in place selects instead of tumbling
+            if (controls->m_mouseTumble &&
+                glm::length(controls->m_mouseLastPos - controls->m_mousePressPos) <= kClickSlop)
+            {
+                controls->m_clicked = true;
+            }
             controls->m_mouseTumble = false;
             controls->m_mousePan = false;
             break;
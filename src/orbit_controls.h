@@ -5,6 +5,7 @@
 
 // Forward Declarations
 class Camera;
+class CameraPath;
 struct GLFWwindow;
 
 // OrbitControls Class
@@ -20,6 +21,11 @@ class OrbitControls
     OrbitControls(OrbitControls &&) = default;
     OrbitControls &operator=(OrbitControls &&) = default;
 
+    // Public Interface
+    void SetRecorder(CameraPath *recorder) noexcept; // Records camera steps while non-null
+    bool IsInteracting() const noexcept;             // A drag is in progress or the wheel moved recently
+    bool TakeClick(glm::vec2 &position) noexcept;    // True once per left click that didn't drag (window coords)
+
   private:
     // Static Callback Functions
     static void CursorPositionCallback(GLFWwindow *window, double xpos, double ypos) noexcept;
@@ -28,11 +34,17 @@ class OrbitControls
 
     // Static Constants
     static constexpr float kZoomSensitivity = 30.0f;
+    static constexpr double kScrollIdleSeconds = 0.25; // The wheel has no release event; treat it as idle after this
+    static constexpr float kClickSlop = 4.0f;          // Pixels the cursor may move between press and release
 
     // Private Member Variables
-    GLFWwindow *m_window; // Non-owning pointer
-    Camera *m_camera;     // Non-owning pointer
+    GLFWwindow *m_window;            // Non-owning pointer
+    Camera *m_camera;                // Non-owning pointer
+    CameraPath *m_recorder{nullptr}; // Non-owning pointer
     bool m_mouseTumble{false};
     bool m_mousePan{false};
     glm::vec2 m_mouseLastPos{0};
+    glm::vec2 m_mousePressPos{0};
+    bool m_clicked{false};
+    double m_lastScrollTime{-1.0e9};
 };
@@ -0,0 +1,416 @@
+// Standard Library Headers
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <filesystem>
+#include <iostream>
+#include <set>
+
+// Project Headers
+#include "camera.h"
+#include "payload_streamer.h"
+
+//----------------------------------------------------------------------
+// Internal Utility Functions
+
+namespace
+{
+
+constexpr uint32_t kPlanInterval = 10;       // Re-plan at least every N updates even if the camera is still
+constexpr float kLoadedPriorityBias = 1.25f; // Hysteresis so payloads near the threshold don't thrash
+
+using FrustumPlanes = std::array<glm::vec4, 6>;
+
+// Gribb/Hartmann plane extraction; planes point inwards
+FrustumPlanes ExtractFrustumPlanes(const glm::mat4 &m)
+{
+    auto row = [&m](int i) { return glm::vec4(m[0][i], m[1][i], m[2][i], m[3][i]); };
+    return {row(3) + row(0), row(3) - row(0), row(3) + row(1), row(3) - row(1), row(3) + row(2), row(3) - row(2)};
+}
+
+bool IsBoxVisible(const FrustumPlanes &planes, const BoundingBox &box)
+{
+    for (const glm::vec4 &plane : planes)
+    {
+        // The box corner furthest along the plane normal
+        glm::vec3 corner(plane.x > 0.0f ? box.max.x : box.min.x, plane.y > 0.0f ? box.max.y : box.min.y,
+                         plane.z > 0.0f ? box.max.z : box.min.z);
+        if (glm::dot(glm::vec3(plane), corner) + plane.w < 0.0f)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Projected radius of the box's bounding sphere as a fraction of the viewport height
+float ScreenSize(const BoundingBox &box, const glm::vec3 &eye, float tanHalfFov)
+{
+    glm::vec3 center = (box.min + box.max) * 0.5f;
+    float radius = glm::length(box.max - box.min) * 0.5f;
+    float distance = glm::length(center - eye);
+    if (distance <= radius)
+    {
+        return 1.0f;
+    }
+    return radius / (distance * tanHalfFov);
+}
+
+// Asset paths of the payload arcs authored on the prim, anchored to the layers that author them
+std::vector<std::string> GetPayloadAssetPaths(const pxr::UsdPrim &prim)
+{
+    std::vector<std::string> assetPaths;
+    for (const pxr::SdfPrimSpecHandle &spec : prim.GetPrimStack())
+    {
+        for (const pxr::SdfPayload &payload : spec->GetPayloadList().GetAddedOrExplicitItems())
+        {
+            if (!payload.GetAssetPath().empty())
+            {
+                assetPaths.push_back(pxr::SdfComputeAssetPathRelativeToLayer(spec->GetLayer(), payload.GetAssetPath()));
+            }
+        }
+    }
+    return assetPaths;
+}
+
+// Opens the layers and everything they sublayer or reference, so composing the payload later needs no I/O
+void PrefetchLayers(const std::vector<std::string> &assetPaths, std::vector<pxr::SdfLayerRefPtr> &layers,
+                    size_t &sizeBytes)
+{
+    std::vector<std::string> pending(assetPaths);
+    std::set<std::string> visited;
+    while (!pending.empty())
+    {
+        std::string assetPath = std::move(pending.back());
+        pending.pop_back();
+        if (!visited.insert(assetPath).second)
+        {
+            continue;
+        }
+
+        pxr::SdfLayerRefPtr layer = pxr::SdfLayer::FindOrOpen(assetPath);
+        if (!layer)
+        {
+            continue;
+        }
+
+        std::error_code error;
+        uintmax_t fileSize = std::filesystem::file_size(layer->GetRealPath(), error);
+        sizeBytes += error ? 0 : static_cast<size_t>(fileSize);
+
+        for (const std::string &dependency : layer->GetCompositionAssetDependencies())
+        {
+            pending.push_back(pxr::SdfComputeAssetPathRelativeToLayer(layer, dependency));
+        }
+        layers.push_back(std::move(layer));
+    }
+}
+
+} // namespace
+
+//----------------------------------------------------------------------
+// PayloadStreamer Class Implementation
+
+PayloadStreamer::PayloadStreamer(const pxr::UsdStageRefPtr &stage, const Settings &settings)
+    : m_stage(stage), m_settings(settings),
+      m_bboxCache(pxr::UsdTimeCode::Default(), pxr::UsdGeomImageable::GetOrderedPurposeTokens(),
+                  /* useExtentsHint = */ true),
+      m_worker(&PayloadStreamer::WorkerLoop, this)
+{
+    AddPayloads(pxr::SdfPath::AbsoluteRootPath());
+    std::cout << "Payload streaming: " << m_payloads.size() << " payloads, budget "
+              << (m_settings.budgetBytes >> 20) << " MB" << std::endl;
+}
+
+PayloadStreamer::~PayloadStreamer()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_quit = true;
+        m_requests.clear();
+    }
+    m_condition.notify_all();
+    m_worker.join();
+}
+
+bool PayloadStreamer::Update(const Camera &camera)
+{
+    bool changed = ApplyLoads();
+
+    glm::mat4 viewProjection = camera.GetProjectionMatrix() * camera.GetViewMatrix();
+    if (changed || viewProjection != m_lastViewProjection || ++m_updatesSincePlan >= kPlanInterval)
+    {
+        // A plan alone only starts reads; the image changes when payloads are composed, or unloaded boxes show
+        changed = Plan(camera) || changed;
+        m_lastViewProjection = viewProjection;
+        m_updatesSincePlan = 0;
+    }
+    return changed;
+}
+
+std::vector<BoundingBox> PayloadStreamer::GetUnloadedBounds() const
+{
+    std::vector<BoundingBox> boxes;
+    for (const auto &[path, payload] : m_payloads)
+    {
+        if (payload.visible && payload.hasBounds && payload.state != State::Loaded)
+        {
+            boxes.push_back(payload.bounds);
+        }
+    }
+    return boxes;
+}
+
+bool PayloadStreamer::IsBusy() const
+{
+    if (!m_pendingUnloads.empty())
+    {
+        return true;
+    }
+    for (const auto &[path, payload] : m_payloads)
+    {
+        if (payload.state == State::Prefetching || payload.state == State::Ready)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void PayloadStreamer::PrintStatus() const
+{
+    size_t counts[4] = {0, 0, 0, 0};
+    size_t residentBytes = 0;
+    for (const auto &[path, payload] : m_payloads)
+    {
+        counts[static_cast<int>(payload.state)]++;
+        if (payload.state != State::Unloaded)
+        {
+            residentBytes += payload.sizeBytes;
+        }
+    }
+
+    std::cout << "Payloads: " << counts[static_cast<int>(State::Loaded)] << " loaded, "
+              << counts[static_cast<int>(State::Ready)] + counts[static_cast<int>(State::Prefetching)]
+              << " in flight, " << counts[static_cast<int>(State::Unloaded)] << " unloaded; "
+              << (residentBytes >> 20) << " / " << (m_settings.budgetBytes >> 20) << " MB" << std::endl;
+}
+
+void PayloadStreamer::AddPayloads(const pxr::SdfPath &root)
+{
+    for (const pxr::SdfPath &path : m_stage->FindLoadable(root))
+    {
+        if (path != root && m_payloads.find(path) == m_payloads.end())
+        {
+            UpdateBounds(path, m_payloads[path]);
+        }
+    }
+}
+
+void PayloadStreamer::UpdateBounds(const pxr::SdfPath &path, Payload &payload)
+{
+    // Unloaded payloads only have bounds if the model authors an extentsHint
+    pxr::UsdPrim prim = m_stage->GetPrimAtPath(path);
+    pxr::GfRange3d range = m_bboxCache.ComputeWorldBound(prim).ComputeAlignedRange();
+    payload.hasBounds = !range.IsEmpty();
+    if (payload.hasBounds)
+    {
+        payload.bounds.min = glm::vec3(range.GetMin()[0], range.GetMin()[1], range.GetMin()[2]);
+        payload.bounds.max = glm::vec3(range.GetMax()[0], range.GetMax()[1], range.GetMax()[2]);
+    }
+}
+
+bool PayloadStreamer::ApplyLoads()
+{
+    // Collect layers the worker has finished reading
+    std::vector<PrefetchResult> results;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        results.swap(m_results);
+    }
+    for (PrefetchResult &result : results)
+    {
+        auto it = m_payloads.find(result.path);
+        if (it != m_payloads.end() && it->second.state == State::Prefetching)
+        {
+            it->second.layers = std::move(result.layers);
+            it->second.sizeBytes = result.sizeBytes;
+            it->second.state = State::Ready;
+        }
+    }
+
+    // Compose a few ready payloads per frame, and apply the unloads decided by the last plan
+    pxr::SdfPathSet loads;
+    for (const auto &[path, payload] : m_payloads)
+    {
+        if (loads.size() >= m_settings.maxLoadsPerFrame)
+        {
+            break;
+        }
+        if (payload.state == State::Ready && payload.priority >= m_settings.minScreenSize)
+        {
+            loads.insert(path);
+        }
+    }
+    pxr::SdfPathSet unloads(m_pendingUnloads.begin(), m_pendingUnloads.end());
+    m_pendingUnloads.clear();
+
+    if (loads.empty() && unloads.empty())
+    {
+        return false;
+    }
+
+    m_stage->LoadAndUnload(loads, unloads, pxr::UsdLoadWithoutDescendants);
+    m_bboxCache.Clear();
+
+    // Unloading a payload also removes any payloads nested inside it
+    for (const pxr::SdfPath &path : unloads)
+    {
+        for (auto it = m_payloads.lower_bound(path); it != m_payloads.end() && it->first.HasPrefix(path);)
+        {
+            if (it->first == path)
+            {
+                it->second.state = State::Unloaded;
+                ++it;
+            }
+            else
+            {
+                it = m_payloads.erase(it);
+            }
+        }
+    }
+
+    // Loaded payloads now have real bounds and may contain nested payloads
+    for (const pxr::SdfPath &path : loads)
+    {
+        Payload &payload = m_payloads[path];
+        payload.state = State::Loaded;
+        payload.layers.clear();
+        UpdateBounds(path, payload);
+        AddPayloads(path);
+    }
+    return true;
+}
+
+bool PayloadStreamer::Plan(const Camera &camera)
+{
+    FrustumPlanes planes = ExtractFrustumPlanes(camera.GetProjectionMatrix() * camera.GetViewMatrix());
+    glm::vec3 eye = camera.GetWorldPosition();
+    float tanHalfFov = std::tan(glm::radians(camera.GetFOV() * 0.5f));
+
+    // Rank payloads by projected size; payloads without bounds must be loaded to learn them
+    std::vector<std::pair<float, pxr::SdfPath>> ranked;
+    ranked.reserve(m_payloads.size());
+    size_t residentBytes = 0;
+    size_t inFlight = 0;
+    bool boundsChanged = false; // The boxes GetUnloadedBounds() returns
+    for (auto &[path, payload] : m_payloads)
+    {
+        bool wasVisible = payload.visible;
+        if (!payload.hasBounds)
+        {
+            payload.visible = true;
+            payload.priority = m_settings.minScreenSize;
+        }
+        else
+        {
+            payload.visible = IsBoxVisible(planes, payload.bounds);
+            payload.priority = payload.visible ? ScreenSize(payload.bounds, eye, tanHalfFov) : 0.0f;
+        }
+        if (payload.visible != wasVisible && payload.hasBounds && payload.state != State::Loaded)
+        {
+            boundsChanged = true;
+        }
+        if (payload.state == State::Loaded)
+        {
+            payload.priority *= kLoadedPriorityBias;
+        }
+        if (payload.state != State::Unloaded)
+        {
+            residentBytes += payload.sizeBytes;
+        }
+        if (payload.state == State::Prefetching || payload.state == State::Ready)
+        {
+            inFlight++;
+        }
+        ranked.emplace_back(payload.priority, path);
+    }
+    std::sort(ranked.begin(), ranked.end(), [](const auto &a, const auto &b) { return a.first > b.first; });
+
+    // Walk the ranking until the budget is used up; everything after that point is not wanted
+    std::set<pxr::SdfPath> wanted;
+    std::vector<PrefetchRequest> requests;
+    size_t wantedBytes = 0;
+    for (const auto &[priority, path] : ranked)
+    {
+        Payload &payload = m_payloads[path];
+        if (priority < m_settings.minScreenSize || wantedBytes + payload.sizeBytes > m_settings.budgetBytes)
+        {
+            break;
+        }
+        wantedBytes += payload.sizeBytes;
+        wanted.insert(path);
+
+        if (payload.state == State::Unloaded && inFlight < 2 * m_settings.maxLoadsPerFrame)
+        {
+            payload.state = State::Prefetching;
+            requests.push_back({path, GetPayloadAssetPaths(m_stage->GetPrimAtPath(path))});
+            inFlight++;
+        }
+    }
+
+    // Drop prefetched layers nobody wants anymore; unload the lowest ranked payloads while over budget
+    for (auto it = ranked.rbegin(); it != ranked.rend(); ++it)
+    {
+        Payload &payload = m_payloads[it->second];
+        if (wanted.count(it->second))
+        {
+            continue;
+        }
+        if (payload.state == State::Ready)
+        {
+            payload.layers.clear();
+            payload.state = State::Unloaded;
+            residentBytes -= payload.sizeBytes;
+        }
+        else if (payload.state == State::Loaded && residentBytes > m_settings.budgetBytes)
+        {
+            m_pendingUnloads.push_back(it->second);
+            residentBytes -= payload.sizeBytes;
+        }
+    }
+
+    if (!requests.empty())
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_requests.insert(m_requests.end(), requests.begin(), requests.end());
+        }
+        m_condition.notify_all();
+    }
+    return boundsChanged;
+}
+
+void PayloadStreamer::WorkerLoop()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true)
+    {
+        m_condition.wait(lock, [this] { return m_quit || !m_requests.empty(); });
+        if (m_quit)
+        {
+            break;
+        }
+
+        PrefetchRequest request = std::move(m_requests.front());
+        m_requests.pop_front();
+        lock.unlock();
+
+        PrefetchResult result;
+        result.path = request.path;
+        PrefetchLayers(request.assetPaths, result.layers, result.sizeBytes);
+
+        lock.lock();
+        m_results.push_back(std::move(result));
+    }
+}
@@ -0,0 +1,110 @@
+#pragma once
+
+// Standard Library Headers
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Third-Party Library Headers
+#include <glm/glm.hpp>
+
+// Project Headers
+#include "bounds_overlay.h"
+#include "usd_headers.h"
+
+// Forward Declarations
+class Camera;
+
+// PayloadStreamer Class
+//
+// Loads and unloads the payloads of a stage opened with UsdStage::LoadNone based on the camera frustum, the
+// projected size of each payload and a memory budget. Payload layers (and everything they reference) are read
+// on a worker thread; the render thread only composes layers that are already in memory, a few per frame.
+class PayloadStreamer
+{
+  public:
+    struct Settings
+    {
+        size_t budgetBytes = size_t(2048) << 20; // Estimated from the on-disk size of payload layers
+        float minScreenSize = 0.01f;             // Fraction of the viewport height below which payloads stay unloaded
+        size_t maxLoadsPerFrame = 8;
+    };
+
+    // Constructor and Destructor
+    PayloadStreamer(const pxr::UsdStageRefPtr &stage, const Settings &settings);
+    ~PayloadStreamer();
+
+    // Deleted Functions
+    PayloadStreamer(const PayloadStreamer &) = delete;
+    PayloadStreamer &operator=(const PayloadStreamer &) = delete;
+
+    /// Applies finished background loads and re-plans what should be resident. Call between frames.
+    /// Returns true if payloads were loaded or unloaded, or GetUnloadedBounds() changed; a re-plan that only
+    /// starts or drops background reads returns false, so an idle viewer is not redrawn.
+    bool Update(const Camera &camera);
+
+    // Accessors
+    std::vector<BoundingBox> GetUnloadedBounds() const; // Visible payloads that are not loaded (yet)
+    bool IsBusy() const;                                // Loads or unloads are in flight
+    void PrintStatus() const;
+
+  private:
+    enum class State
+    {
+        Unloaded,
+        Prefetching, // Layers are being read on the worker
+        Ready,       // Layers are in memory, waiting to be composed
+        Loaded
+    };
+
+    struct Payload
+    {
+        State state = State::Unloaded;
+        BoundingBox bounds;
+        bool hasBounds = false;
+        bool visible = false;
+        float priority = 0.0f;
+        size_t sizeBytes = 0;
+        std::vector<pxr::SdfLayerRefPtr> layers; // Keeps prefetched layers open until the stage owns them
+    };
+
+    struct PrefetchRequest
+    {
+        pxr::SdfPath path;
+        std::vector<std::string> assetPaths;
+    };
+
+    struct PrefetchResult
+    {
+        pxr::SdfPath path;
+        std::vector<pxr::SdfLayerRefPtr> layers;
+        size_t sizeBytes = 0;
+    };
+
+    void AddPayloads(const pxr::SdfPath &root);
+    void UpdateBounds(const pxr::SdfPath &path, Payload &payload);
+    bool ApplyLoads();
+    bool Plan(const Camera &camera); // Returns true if GetUnloadedBounds() changed
+    void WorkerLoop();
+
+    pxr::UsdStageRefPtr m_stage;
+    Settings m_settings;
+    pxr::UsdGeomBBoxCache m_bboxCache;
+    std::map<pxr::SdfPath, Payload> m_payloads;
+    pxr::SdfPathVector m_pendingUnloads;
+    glm::mat4 m_lastViewProjection{0.0f};
+    uint32_t m_updatesSincePlan = 0; // Update() runs on every main loop wakeup, not once per frame
+
+    // Worker
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    std::deque<PrefetchRequest> m_requests;
+    std::vector<PrefetchResult> m_results;
+    bool m_quit = false;
+    std::thread m_worker; // Last, so it starts after the state above is constructed
+};
@@ -0,0 +1,147 @@
+// Standard Library Headers
+#include <cstdio>
+#include <iostream>
+
+// Project Headers
+#include "prim_outline.h"
+
+//----------------------------------------------------------------------
+// Internal Utility Functions
+
+namespace
+{
+
+// The strongest authored type name, from the strongest node and layer that has one
+pxr::TfToken ComposeTypeName(const pxr::PcpPrimIndex &index)
+{
+    pxr::TfToken typeName;
+    for (const pxr::PcpNodeRef &node : index.GetNodeRange())
+    {
+        if (!node.HasSpecs())
+        {
+            continue;
+        }
+        for (const pxr::SdfLayerRefPtr &layer : node.GetLayerStack()->GetLayers())
+        {
+            if (layer->HasField(node.GetPath(), pxr::SdfFieldKeys->TypeName, &typeName) && !typeName.IsEmpty())
+            {
+                return typeName;
+            }
+        }
+    }
+    return typeName;
+}
+
+pxr::TfTokenVector ComputeChildNames(const pxr::PcpPrimIndex &index)
+{
+    pxr::TfTokenVector names;
+    pxr::PcpTokenSet prohibitedNames;
+    index.ComputePrimChildNames(&names, &prohibitedNames);
+    return names;
+}
+
+} // namespace
+
+//----------------------------------------------------------------------
+// PrimOutline Class Implementation
+
+PrimOutline::PrimOutline(const std::string &filename) : m_rootLayer(pxr::SdfLayer::FindOrOpen(filename))
+{
+    if (!m_rootLayer)
+    {
+        std::cerr << "PrimOutline: cannot open " << filename << std::endl;
+        return;
+    }
+
+    // Same layer stack and USD mode as UsdStage::Open, without a session layer
+    pxr::ArResolverContext context = pxr::ArGetResolver().CreateDefaultContextForAsset(filename);
+    m_cache = std::make_unique<pxr::PcpCache>(
+        pxr::PcpLayerStackIdentifier(m_rootLayer, pxr::SdfLayerHandle(), context), "usd", /* usd = */ true);
+}
+
+std::vector<PrimOutline::Entry> PrimOutline::GetChildren(const pxr::SdfPath &path)
+{
+    std::vector<Entry> children;
+    const pxr::PcpPrimIndex *index = ComputeIndex(path);
+    if (!index)
+    {
+        return children;
+    }
+
+    for (const pxr::TfToken &name : ComputeChildNames(*index))
+    {
+        Entry entry;
+        entry.path = path.AppendChild(name);
+        if (const pxr::PcpPrimIndex *childIndex = ComputeIndex(entry.path))
+        {
+            entry.typeName = ComposeTypeName(*childIndex);
+            entry.childCount = ComputeChildNames(*childIndex).size();
+            entry.hasPayload = childIndex->HasAnyPayloads();
+        }
+        children.push_back(std::move(entry));
+    }
+    return children;
+}
+
+void PrimOutline::Print(const pxr::SdfPath &path, uint32_t depth)
+{
+    std::printf("%s\n", path.GetText());
+    PrintChildren(path, depth, 1);
+    std::fflush(stdout);
+}
+
+pxr::SdfPath PrimOutline::GetDefaultPrimPath() const
+{
+    pxr::TfToken defaultPrim = m_rootLayer ? m_rootLayer->GetDefaultPrim() : pxr::TfToken();
+    return defaultPrim.IsEmpty() ? pxr::SdfPath() : pxr::SdfPath::AbsoluteRootPath().AppendChild(defaultPrim);
+}
+
+const pxr::PcpPrimIndex *PrimOutline::ComputeIndex(const pxr::SdfPath &path)
+{
+    if (!m_cache)
+    {
+        return nullptr;
+    }
+
+    pxr::PcpErrorVector errors;
+    const pxr::PcpPrimIndex &index = m_cache->ComputePrimIndex(path, &errors);
+    return index.IsValid() ? &index : nullptr;
+}
+
+void PrimOutline::PrintChildren(const pxr::SdfPath &path, uint32_t depth, int indent)
+{
+    if (depth == 0)
+    {
+        return;
+    }
+
+    for (const Entry &entry : GetChildren(path))
+    {
+        std::printf("%*s%s (%s, %zu children)%s\n", indent * 2, "", entry.path.GetText(),
+                    entry.typeName.IsEmpty() ? "untyped" : entry.typeName.GetText(), entry.childCount,
+                    entry.hasPayload ? " [payload]" : "");
+        PrintChildren(entry.path, depth - 1, indent + 1);
+    }
+}
+
+//----------------------------------------------------------------------
+// Command-Line Outline
+
+bool PrintPrimOutline(const std::string &filename, const std::string &path, uint32_t depth)
+{
+    if (!pxr::SdfPath::IsValidPathString(path) || !pxr::SdfPath(path).IsAbsoluteRootOrPrimPath())
+    {
+        std::cerr << "Invalid prim path: " << path << std::endl;
+        return false;
+    }
+
+    PrimOutline outline(filename);
+    if (!outline.IsValid())
+    {
+        return false;
+    }
+
+    std::printf("Outline of %s (default prim %s)\n", filename.c_str(), outline.GetDefaultPrimPath().GetText());
+    outline.Print(pxr::SdfPath(path), depth);
+    return true;
+}
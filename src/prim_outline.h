@@ -0,0 +1,55 @@
+#pragma once
+
+// Standard Library Headers
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Project Headers
+#include "usd_headers.h"
+
+// PrimOutline Class
+//
+// Lists a scene's prim hierarchy without composing the scene. Each expanded prim is composed on its own with a
+// PcpCache (ancestors once, then cached), so listing the top levels of a huge assembly reads only the layers
+// those prims get their opinions from and composes nothing below them. Payloads are not included, so prims
+// inside a payload are not listed; the prims that have one are marked. The listed paths are what
+// --mask, --isolate and --exclude take.
+class PrimOutline
+{
+  public:
+    struct Entry
+    {
+        pxr::SdfPath path;
+        pxr::TfToken typeName;
+        size_t childCount = 0;
+        bool hasPayload = false;
+    };
+
+    // Constructor
+    explicit PrimOutline(const std::string &filename);
+
+    // Public Interface
+    bool IsValid() const noexcept { return m_cache != nullptr; }
+
+    /// Children of `path` in namespace order. Composes them to count their own children, and nothing deeper.
+    std::vector<Entry> GetChildren(const pxr::SdfPath &path);
+
+    /// Prints `path` and `depth` levels of descendants, indented.
+    void Print(const pxr::SdfPath &path, uint32_t depth);
+
+    // Accessors
+    pxr::SdfPath GetDefaultPrimPath() const;
+
+  private:
+    const pxr::PcpPrimIndex *ComputeIndex(const pxr::SdfPath &path);
+    void PrintChildren(const pxr::SdfPath &path, uint32_t depth, int indent);
+
+    pxr::SdfLayerRefPtr m_rootLayer;
+    std::unique_ptr<pxr::PcpCache> m_cache;
+};
+
+// Prints the outline of `filename` below `path` ("/" for the root prims) and returns false if it can't.
+bool PrintPrimOutline(const std::string &filename, const std::string &path, uint32_t depth);
@@ -0,0 +1,223 @@
+// Standard Library Headers
+#include <array>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+// Third-Party Library Headers
+#include <glad/glad.h>
+
+// Project Headers
+#include "disk_cache.h"
+#include "program_cache.h"
+#include "usd_headers.h"
+
+//----------------------------------------------------------------------
+// Internal Utility Functions
+
+namespace
+{
+
+constexpr uint32_t kFileMagic = 0x42505655;  // "UVPB"
+constexpr uint32_t kMaxBinaryBytes = 64 << 20; // Far above any program binary the viewer links
+
+struct FileHeader
+{
+    uint32_t magic = kFileMagic;
+    uint32_t format = 0;
+    uint32_t length = 0;
+};
+
+std::string GetGLString(GLenum name)
+{
+    const GLubyte *value = glGetString(name);
+    return value ? reinterpret_cast<const char *>(value) : std::string();
+}
+
+GLuint CompileShader(const char *name, GLenum type, const char *source)
+{
+    GLuint shader = glCreateShader(type);
+    glShaderSource(shader, 1, &source, nullptr);
+    glCompileShader(shader);
+
+    GLint status = GL_FALSE;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &status);
+    if (status != GL_TRUE)
+    {
+        std::array<char, 1024> log{};
+        glGetShaderInfoLog(shader, static_cast<GLsizei>(log.size()), nullptr, log.data());
+        std::cerr << name << ": shader compilation failed: " << log.data() << std::endl;
+    }
+    return shader;
+}
+
+bool IsLinked(GLuint program)
+{
+    GLint status = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &status);
+    return status == GL_TRUE;
+}
+
+void SetEnvironment(const char *name, const std::string &value)
+{
+    if (std::getenv(name))
+    {
+        return;
+    }
+#if defined(_WIN32)
+    _putenv_s(name, value.c_str());
+#else
+    setenv(name, value.c_str(), 0);
+#endif
+}
+
+} // namespace
+
+//----------------------------------------------------------------------
+// ProgramCache Class Implementation
+
+ProgramCache::ProgramCache(const std::string &directory) : m_directory(directory)
+{
+    GLint formatCount = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+    m_binariesSupported = formatCount > 0;
+    m_driverKey = GetGLString(GL_RENDERER) + "|" + GetGLString(GL_VERSION) + "|" + std::to_string(PXR_VERSION);
+
+    std::error_code error;
+    if (!m_directory.empty() && m_binariesSupported && !std::filesystem::create_directories(m_directory, error) &&
+        error)
+    {
+        std::cerr << "ProgramCache: cannot create " << m_directory << "; programs are not cached." << std::endl;
+        m_directory.clear();
+    }
+}
+
+uint32_t ProgramCache::GetProgram(const char *name, const char *vertexSource, const char *fragmentSource)
+{
+    std::string file;
+    if (!m_directory.empty() && m_binariesSupported)
+    {
+        std::string hash = FormatHash(HashString(m_driverKey + '\0' + vertexSource + '\0' + fragmentSource));
+        file = (std::filesystem::path(m_directory) / (hash + ".bin")).string();
+
+        if (GLuint program = LoadProgram(file))
+        {
+            return program;
+        }
+    }
+
+    GLuint vertexShader = CompileShader(name, GL_VERTEX_SHADER, vertexSource);
+    GLuint fragmentShader = CompileShader(name, GL_FRAGMENT_SHADER, fragmentSource);
+
+    GLuint program = glCreateProgram();
+    if (!file.empty())
+    {
+        glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
+    glAttachShader(program, vertexShader);
+    glAttachShader(program, fragmentShader);
+    glLinkProgram(program);
+    glDeleteShader(vertexShader);
+    glDeleteShader(fragmentShader);
+
+    if (!IsLinked(program))
+    {
+        std::cerr << name << ": program link failed." << std::endl;
+        glDeleteProgram(program);
+        return 0;
+    }
+    if (!file.empty())
+    {
+        SaveProgram(program, file);
+    }
+    return program;
+}
+
+uint32_t ProgramCache::LoadProgram(const std::string &file) const
+{
+    std::error_code error;
+    uintmax_t fileSize = std::filesystem::file_size(file, error);
+    if (error)
+    {
+        return 0;
+    }
+
+    // The length comes from the file, so check it before allocating; truncated or corrupt entries are removed
+    std::vector<char> binary;
+    FileHeader header;
+    {
+        std::ifstream in(file, std::ios::binary);
+        if (!in || !in.read(reinterpret_cast<char *>(&header), sizeof(header)) || header.magic != kFileMagic ||
+            header.length == 0 || header.length > kMaxBinaryBytes || fileSize != sizeof(header) + header.length)
+        {
+            in.close();
+            std::filesystem::remove(file, error);
+            return 0;
+        }
+        binary.resize(header.length);
+        if (!in.read(binary.data(), binary.size()))
+        {
+            in.close();
+            std::filesystem::remove(file, error);
+            return 0;
+        }
+    }
+
+    // Drivers may still reject a binary (e.g. after an update that kept the version string); compile it then
+    GLuint program = glCreateProgram();
+    glProgramBinary(program, header.format, binary.data(), static_cast<GLsizei>(binary.size()));
+    if (!IsLinked(program))
+    {
+        glDeleteProgram(program);
+        return 0;
+    }
+    return program;
+}
+
+void ProgramCache::SaveProgram(uint32_t program, const std::string &file) const
+{
+    GLint length = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0)
+    {
+        return;
+    }
+
+    FileHeader header;
+    std::vector<char> binary(length);
+    GLenum format = 0;
+    glGetProgramBinary(program, length, &length, &format, binary.data());
+    header.format = format;
+    header.length = static_cast<uint32_t>(length);
+
+    bool written = WriteFileAtomically(file, [&](const std::string &tempFile) {
+        std::ofstream out(tempFile, std::ios::binary | std::ios::trunc);
+        return out.write(reinterpret_cast<const char *>(&header), sizeof(header)) &&
+               out.write(binary.data(), header.length);
+    });
+    if (!written)
+    {
+        std::cerr << "ProgramCache: cannot write " << file << std::endl;
+    }
+}
+
+//----------------------------------------------------------------------
+// Driver Shader Cache
+
+void EnableDriverShaderCache(const std::string &directory)
+{
+    std::string driverDirectory = (std::filesystem::path(directory) / "driver").string();
+    std::error_code error;
+    std::filesystem::create_directories(driverDirectory, error);
+
+    // Mesa (hardware drivers and llvmpipe); older releases only read MESA_GLSL_CACHE_DIR
+    SetEnvironment("MESA_SHADER_CACHE_DIR", driverDirectory);
+    SetEnvironment("MESA_GLSL_CACHE_DIR", driverDirectory);
+
+    // NVIDIA
+    SetEnvironment("__GL_SHADER_DISK_CACHE", "1");
+    SetEnvironment("__GL_SHADER_DISK_CACHE_PATH", driverDirectory);
+    SetEnvironment("__GL_SHADER_DISK_CACHE_SKIP_CLEANUP", "1");
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+// Standard Library Headers
+#include <cstdint>
+#include <string>
+
+// ProgramCache Class
+//
+// Links GL programs from source the first time and keeps the driver's binary of each on disk
+// (glGetProgramBinary), so later runs load it with glProgramBinary instead of compiling and linking again.
+// Binaries are keyed by their sources, the GL renderer and version strings and the OpenUSD version, so a driver
+// or USD update misses the cache rather than loading a binary that no longer fits. Requires a current GL context.
+//
+// Storm compiles its own programs through Hgi, out of reach of this cache; EnableDriverShaderCache() points the
+// driver's on-disk shader cache at the same directory to cover those.
+class ProgramCache
+{
+  public:
+    /// An empty directory disables the cache; programs are then always compiled.
+    explicit ProgramCache(const std::string &directory);
+
+    // Deleted Functions
+    ProgramCache(const ProgramCache &) = delete;
+    ProgramCache &operator=(const ProgramCache &) = delete;
+
+    /// Returns a linked program, or 0 if compiling or linking failed. `name` labels error messages.
+    uint32_t GetProgram(const char *name, const char *vertexSource, const char *fragmentSource);
+
+  private:
+    uint32_t LoadProgram(const std::string &file) const;
+    void SaveProgram(uint32_t program, const std::string &file) const;
+
+    std::string m_directory;
+    std::string m_driverKey; // Renderer, GL version and OpenUSD version
+    bool m_binariesSupported = false;
+};
+
+// Enables the driver's on-disk shader cache (Mesa, including llvmpipe, and NVIDIA) in a subdirectory of
+// `directory`, unless the environment already configures it. Must be called before the GL context is created.
+void EnableDriverShaderCache(const std::string &directory);
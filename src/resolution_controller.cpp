@@ -0,0 +1,47 @@
+// Standard Library Headers
+#include <algorithm>
+#include <cmath>
+
+// Project Headers
+#include "resolution_controller.h"
+
+//----------------------------------------------------------------------
+// ResolutionController Class Implementation
+
+ResolutionController::ResolutionController(const Settings &settings) : m_settings(settings)
+{
+}
+
+float ResolutionController::Update(bool interacting, double lastFrameMs)
+{
+    if (!interacting || m_settings.frameBudgetMs <= 0.0)
+    {
+        m_scale = 1.0f;
+        return m_scale;
+    }
+
+    if (lastFrameMs <= 0.0)
+    {
+        return m_scale;
+    }
+
+    double ratio = m_settings.frameBudgetMs / lastFrameMs;
+    if (std::abs(ratio - 1.0) < kDeadBand)
+    {
+        return m_scale;
+    }
+
+    // Frame cost is roughly proportional to the pixel count, i.e. to the square of the scale
+    float target = m_scale * static_cast<float>(std::sqrt(ratio));
+    target = std::clamp(std::floor(target / kStep) * kStep, m_settings.minScale, 1.0f);
+
+    // Drop straight to the target, but recover one step at a time so a single cheap frame doesn't bounce
+    // back to an expensive resolution
+    m_scale = target < m_scale ? target : std::min(m_scale + kStep, target);
+    return m_scale;
+}
+
+float ResolutionController::GetScale() const noexcept
+{
+    return m_scale;
+}
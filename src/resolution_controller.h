@@ -0,0 +1,33 @@
+#pragma once
+
+// ResolutionController Class
+//
+// Picks the render resolution scale from measured frame times: while the camera is being moved the scale
+// drops until frames fit the budget, and full resolution is restored as soon as the camera is idle.
+class ResolutionController
+{
+  public:
+    struct Settings
+    {
+        double frameBudgetMs = 33.3; // 0 disables adaptive resolution
+        float minScale = 0.25f;      // Smallest fraction of the framebuffer size to render at
+    };
+
+    // Constructor
+    explicit ResolutionController(const Settings &settings);
+
+    /// Returns the scale for the next frame, given whether the camera is moving and the cost of the last frame.
+    float Update(bool interacting, double lastFrameMs);
+
+    // Accessors
+    float GetScale() const noexcept;
+
+  private:
+    // Static Constants
+    static constexpr float kStep = 0.05f;     // Scales are quantized so the AOVs are not reallocated every frame
+    static constexpr double kDeadBand = 0.15; // Frame times within this fraction of the budget are left alone
+
+    // Private Member Variables
+    Settings m_settings;
+    float m_scale = 1.0f;
+};
@@ -0,0 +1,486 @@
+// Standard Library Headers
+#include <algorithm>
+#include <cfloat>
+#include <limits>
+#include <numeric>
+
+// Third-Party Library Headers
+#include <tbb/parallel_invoke.h>
+
+// Project Headers
+#include "scene_bvh.h"
+
+//----------------------------------------------------------------------
+// Internal Utility Functions
+
+namespace
+{
+
+constexpr uint32_t kLeafSize = 4;              // Most items per leaf
+constexpr uint32_t kParallelBuildItems = 4096; // Subtrees larger than this build their halves in parallel
+const glm::vec3 kEmptyMin(FLT_MAX);
+const glm::vec3 kEmptyMax(-FLT_MAX);
+
+glm::vec3 ToVec3(const pxr::GfVec3d &v)
+{
+    return glm::vec3(v[0], v[1], v[2]);
+}
+
+// Distance along the ray to where it enters the box, if it hits it in front of the origin
+bool IntersectBox(const glm::vec3 &min, const glm::vec3 &max, const glm::vec3 &origin, const glm::vec3 &invDirection,
+                  float &distance)
+{
+    if (min.x > max.x)
+    {
+        return false; // Empty
+    }
+
+    glm::vec3 t0 = (min - origin) * invDirection;
+    glm::vec3 t1 = (max - origin) * invDirection;
+    glm::vec3 tNear = glm::min(t0, t1);
+    glm::vec3 tFar = glm::max(t0, t1);
+    float enter = std::max(std::max(tNear.x, tNear.y), std::max(tNear.z, 0.0f));
+    float exit = std::min(std::min(tFar.x, tFar.y), tFar.z);
+    distance = enter;
+    return enter <= exit;
+}
+
+// Distance along `ray` (in world space) to the nearest triangle of `mesh`, or a negative value if it misses
+double IntersectMesh(const pxr::UsdGeomMesh &mesh, const pxr::GfMatrix4d &localToWorld, const pxr::GfRay &ray,
+                     pxr::UsdTimeCode time, double maxDistance)
+{
+    pxr::VtVec3fArray points;
+    pxr::VtIntArray faceVertexCounts;
+    pxr::VtIntArray faceVertexIndices;
+    if (!mesh.GetPointsAttr().Get(&points, time) || !mesh.GetFaceVertexCountsAttr().Get(&faceVertexCounts, time) ||
+        !mesh.GetFaceVertexIndicesAttr().Get(&faceVertexIndices, time))
+    {
+        return -1.0;
+    }
+
+    // An affine transform keeps distances along the ray, so hits in local space need no conversion back
+    pxr::GfRay localRay = ray;
+    localRay.Transform(localToWorld.GetInverse());
+
+    double nearest = -1.0;
+    size_t offset = 0;
+    for (int count : faceVertexCounts)
+    {
+        if (count < 3 || offset + count > faceVertexIndices.size())
+        {
+            offset += std::max(count, 0);
+            continue;
+        }
+
+        // Faces are fanned into triangles around their first vertex
+        for (int k = 1; k + 1 < count; ++k)
+        {
+            int i0 = faceVertexIndices[offset];
+            int i1 = faceVertexIndices[offset + k];
+            int i2 = faceVertexIndices[offset + k + 1];
+            if (std::max({i0, i1, i2}) >= static_cast<int>(points.size()) || std::min({i0, i1, i2}) < 0)
+            {
+                continue;
+            }
+
+            double distance = 0.0;
+            double limit = nearest >= 0.0 ? nearest : maxDistance;
+            if (localRay.Intersect(pxr::GfVec3d(points[i0]), pxr::GfVec3d(points[i1]), pxr::GfVec3d(points[i2]),
+                                   &distance, nullptr, nullptr, limit))
+            {
+                nearest = distance;
+            }
+        }
+        offset += count;
+    }
+    return nearest;
+}
+
+// True if the prim's world bounds can change over time
+bool MightBeAnimated(const pxr::UsdPrim &prim, pxr::UsdGeomXformCache &xformCache)
+{
+    for (pxr::UsdPrim ancestor = prim; ancestor && !ancestor.IsPseudoRoot(); ancestor = ancestor.GetParent())
+    {
+        if (xformCache.TransformMightBeTimeVarying(ancestor))
+        {
+            return true;
+        }
+    }
+
+    pxr::UsdGeomPointBased pointBased(prim);
+    if (pointBased && pointBased.GetPointsAttr().ValueMightBeTimeVarying())
+    {
+        return true;
+    }
+    return pxr::UsdGeomBoundable(prim).GetExtentAttr().ValueMightBeTimeVarying();
+}
+
+// Edits to these properties move or resize a prim and everything below it
+bool AffectsBounds(const pxr::TfToken &name)
+{
+    return pxr::UsdGeomXformOp::IsXformOp(name) || name == pxr::UsdGeomTokens->xformOpOrder ||
+           name == pxr::UsdGeomTokens->extent || name == pxr::UsdGeomTokens->points ||
+           name == pxr::UsdGeomTokens->visibility;
+}
+
+} // namespace
+
+//----------------------------------------------------------------------
+// SceneBvh Class Implementation
+
+void SceneBvh::Build(const pxr::UsdStageRefPtr &stage, pxr::UsdTimeCode time)
+{
+    m_items.clear();
+    m_rebuild = false;
+    m_dirtyPaths.clear();
+    m_time = time;
+
+    // Instance proxies are included, so each instance can be picked on its own
+    pxr::UsdPrimRange range(stage->GetPseudoRoot(), pxr::UsdTraverseInstanceProxies());
+    for (auto it = range.begin(); it != range.end(); ++it)
+    {
+        if (it->IsA<pxr::UsdGeomGprim>() || it->IsA<pxr::UsdGeomPointInstancer>())
+        {
+            Item item;
+            item.path = it->GetPath();
+            m_items.push_back(item);
+            it.PruneChildren();
+        }
+    }
+
+    std::vector<uint32_t> all(m_items.size());
+    std::iota(all.begin(), all.end(), 0);
+    ComputeBounds(stage, time, all);
+
+    m_byPath = all;
+    std::sort(m_byPath.begin(), m_byPath.end(),
+              [this](uint32_t a, uint32_t b) { return m_items[a].path < m_items[b].path; });
+    BuildNodes();
+}
+
+void SceneBvh::OnObjectsChanged(const pxr::UsdNotice::ObjectsChanged &notice)
+{
+    for (const pxr::SdfPath &path : notice.GetResyncedPaths())
+    {
+        // Adding an xform op resyncs the attribute, but leaves the prims in place
+        if (!path.IsPropertyPath())
+        {
+            m_rebuild = true;
+            return;
+        }
+        if (AffectsBounds(path.GetNameToken()))
+        {
+            m_dirtyPaths.insert(path.GetPrimPath());
+        }
+    }
+    for (const pxr::SdfPath &path : notice.GetChangedInfoOnlyPaths())
+    {
+        if (path.IsPropertyPath() && AffectsBounds(path.GetNameToken()))
+        {
+            m_dirtyPaths.insert(path.GetPrimPath());
+        }
+    }
+}
+
+bool SceneBvh::Pick(const pxr::UsdStageRefPtr &stage, pxr::UsdTimeCode time, const glm::vec3 &origin,
+                    const glm::vec3 &direction, pxr::SdfPath &path)
+{
+    Update(stage, time);
+    if (m_nodes.empty())
+    {
+        return false;
+    }
+
+    // Front to back: a subtree is skipped once a closer surface has been hit
+    glm::vec3 invDirection = 1.0f / direction;
+    pxr::GfRay ray(pxr::GfVec3d(origin.x, origin.y, origin.z), pxr::GfVec3d(direction.x, direction.y, direction.z));
+    double nearest = std::numeric_limits<double>::infinity();
+    const Item *hit = nullptr;
+
+    float distance = 0.0f;
+    if (!IntersectBox(m_nodes[0].min, m_nodes[0].max, origin, invDirection, distance))
+    {
+        return false;
+    }
+    std::vector<std::pair<uint32_t, float>> stack{{0, distance}};
+    while (!stack.empty())
+    {
+        auto [index, enter] = stack.back();
+        stack.pop_back();
+        if (enter > nearest)
+        {
+            continue;
+        }
+
+        const Node &node = m_nodes[index];
+        if (node.count > 0)
+        {
+            for (uint32_t i = node.first; i < node.first + node.count; ++i)
+            {
+                const Item &item = m_items[m_order[i]];
+                if (!IntersectBox(item.min, item.max, origin, invDirection, distance) || distance > nearest)
+                {
+                    continue;
+                }
+
+                // Other gprims are hit where the ray enters their bounds
+                double surface = distance;
+                pxr::UsdGeomMesh mesh(stage->GetPrimAtPath(item.path));
+                if (mesh)
+                {
+                    surface = IntersectMesh(mesh, item.localToWorld, ray, time, nearest);
+                }
+                if (surface >= 0.0 && surface < nearest)
+                {
+                    nearest = surface;
+                    hit = &item;
+                }
+            }
+            continue;
+        }
+
+        // Visit the nearer child first
+        float enterLeft = 0.0f;
+        float enterRight = 0.0f;
+        const Node &left = m_nodes[node.first];
+        const Node &right = m_nodes[node.first + 1];
+        bool hitLeft = IntersectBox(left.min, left.max, origin, invDirection, enterLeft);
+        bool hitRight = IntersectBox(right.min, right.max, origin, invDirection, enterRight);
+        if (hitLeft && hitRight && enterLeft < enterRight)
+        {
+            stack.push_back({node.first + 1, enterRight});
+            stack.push_back({node.first, enterLeft});
+        }
+        else
+        {
+            if (hitLeft)
+            {
+                stack.push_back({node.first, enterLeft});
+            }
+            if (hitRight)
+            {
+                stack.push_back({node.first + 1, enterRight});
+            }
+        }
+    }
+
+    if (!hit)
+    {
+        return false;
+    }
+    path = hit->path;
+    return true;
+}
+
+bool SceneBvh::GetBounds(const pxr::UsdStageRefPtr &stage, pxr::UsdTimeCode time, const pxr::SdfPath &path,
+                         glm::vec3 &minBounds, glm::vec3 &maxBounds)
+{
+    Update(stage, time);
+    if (m_nodes.empty())
+    {
+        return false;
+    }
+
+    glm::vec3 min = kEmptyMin;
+    glm::vec3 max = kEmptyMax;
+    if (path == pxr::SdfPath::AbsoluteRootPath())
+    {
+        min = m_nodes[0].min;
+        max = m_nodes[0].max;
+    }
+    else
+    {
+        for (uint32_t i : FindItems(path))
+        {
+            min = glm::min(min, m_items[i].min);
+            max = glm::max(max, m_items[i].max);
+        }
+    }
+
+    if (min.x > max.x)
+    {
+        return false;
+    }
+    minBounds = min;
+    maxBounds = max;
+    return true;
+}
+
+void SceneBvh::Update(const pxr::UsdStageRefPtr &stage, pxr::UsdTimeCode time)
+{
+    if (m_rebuild)
+    {
+        Build(stage, time);
+        return;
+    }
+
+    // Static prims keep their bounds when the time changes
+    std::vector<uint32_t> items;
+    if (time != m_time)
+    {
+        for (uint32_t i = 0; i < m_items.size(); ++i)
+        {
+            if (m_items[i].animated)
+            {
+                items.push_back(i);
+            }
+        }
+        m_time = time;
+    }
+    for (const pxr::SdfPath &path : m_dirtyPaths)
+    {
+        std::vector<uint32_t> below = FindItems(path);
+        items.insert(items.end(), below.begin(), below.end());
+    }
+    m_dirtyPaths.clear();
+    if (items.empty())
+    {
+        return;
+    }
+
+    std::sort(items.begin(), items.end());
+    items.erase(std::unique(items.begin(), items.end()), items.end());
+    ComputeBounds(stage, time, items);
+    RefitNodes();
+}
+
+void SceneBvh::ComputeBounds(const pxr::UsdStageRefPtr &stage, pxr::UsdTimeCode time,
+                             const std::vector<uint32_t> &items)
+{
+    // The caches are not thread-safe, so each chunk of prims gets its own
+    pxr::TfTokenVector purposes = {pxr::UsdGeomTokens->default_, pxr::UsdGeomTokens->render};
+    pxr::WorkParallelForN(items.size(), [&](size_t begin, size_t end) {
+        pxr::UsdGeomBBoxCache bboxCache(time, purposes);
+        pxr::UsdGeomXformCache xformCache(time);
+        for (size_t i = begin; i < end; ++i)
+        {
+            Item &item = m_items[items[i]];
+            item.min = kEmptyMin;
+            item.max = kEmptyMax;
+            pxr::UsdPrim prim = stage->GetPrimAtPath(item.path);
+            if (!prim)
+            {
+                continue;
+            }
+
+            // Invisible prims have empty bounds, so they can't be picked
+            pxr::GfRange3d bounds = bboxCache.ComputeWorldBound(prim).ComputeAlignedRange();
+            item.localToWorld = xformCache.GetLocalToWorldTransform(prim);
+            item.animated = MightBeAnimated(prim, xformCache);
+            if (!bounds.IsEmpty())
+            {
+                item.min = ToVec3(bounds.GetMin());
+                item.max = ToVec3(bounds.GetMax());
+            }
+        }
+    });
+}
+
+void SceneBvh::BuildNodes()
+{
+    m_order.resize(m_items.size());
+    std::iota(m_order.begin(), m_order.end(), 0);
+    if (m_items.empty())
+    {
+        m_nodes.clear();
+        return;
+    }
+
+    // Halving stops before a leaf would get fewer than 2 items, so there are at most n / 2 leaves and n nodes
+    m_nodes.assign(m_items.size() + 1, Node());
+    std::atomic<uint32_t> nodeCount{1};
+    BuildSubtree(0, 0, static_cast<uint32_t>(m_items.size()), nodeCount);
+    m_nodes.resize(nodeCount);
+}
+
+void SceneBvh::BuildSubtree(uint32_t index, uint32_t begin, uint32_t end, std::atomic<uint32_t> &nodeCount)
+{
+    Node &node = m_nodes[index];
+    node.min = kEmptyMin;
+    node.max = kEmptyMax;
+    glm::vec3 centerMin = kEmptyMin;
+    glm::vec3 centerMax = kEmptyMax;
+    for (uint32_t i = begin; i < end; ++i)
+    {
+        const Item &item = m_items[m_order[i]];
+        if (item.min.x > item.max.x)
+        {
+            continue;
+        }
+        node.min = glm::min(node.min, item.min);
+        node.max = glm::max(node.max, item.max);
+        glm::vec3 center = (item.min + item.max) * 0.5f;
+        centerMin = glm::min(centerMin, center);
+        centerMax = glm::max(centerMax, center);
+    }
+
+    if (end - begin <= kLeafSize)
+    {
+        node.first = begin;
+        node.count = end - begin;
+        return;
+    }
+
+    // Split at the median along the axis where the item centers are spread the most
+    glm::vec3 spread = centerMax - centerMin;
+    int axis = spread.x > spread.y ? (spread.x > spread.z ? 0 : 2) : (spread.y > spread.z ? 1 : 2);
+    uint32_t middle = begin + (end - begin) / 2;
+    auto center = [this, axis](uint32_t i) { return m_items[i].min[axis] + m_items[i].max[axis]; };
+    std::nth_element(m_order.begin() + begin, m_order.begin() + middle, m_order.begin() + end,
+                     [&center](uint32_t a, uint32_t b) { return center(a) < center(b); });
+
+    // Children are allocated after their parent, so a reverse walk over the nodes visits children first
+    uint32_t children = nodeCount.fetch_add(2);
+    node.first = children;
+    node.count = 0;
+    if (end - begin > kParallelBuildItems)
+    {
+        tbb::parallel_invoke([&] { BuildSubtree(children, begin, middle, nodeCount); },
+                             [&] { BuildSubtree(children + 1, middle, end, nodeCount); });
+    }
+    else
+    {
+        BuildSubtree(children, begin, middle, nodeCount);
+        BuildSubtree(children + 1, middle, end, nodeCount);
+    }
+}
+
+void SceneBvh::RefitNodes()
+{
+    for (size_t index = m_nodes.size(); index-- > 0;)
+    {
+        Node &node = m_nodes[index];
+        node.min = kEmptyMin;
+        node.max = kEmptyMax;
+        if (node.count > 0)
+        {
+            for (uint32_t i = node.first; i < node.first + node.count; ++i)
+            {
+                const Item &item = m_items[m_order[i]];
+                if (item.min.x <= item.max.x)
+                {
+                    node.min = glm::min(node.min, item.min);
+                    node.max = glm::max(node.max, item.max);
+                }
+            }
+        }
+        else
+        {
+            node.min = glm::min(m_nodes[node.first].min, m_nodes[node.first + 1].min);
+            node.max = glm::max(m_nodes[node.first].max, m_nodes[node.first + 1].max);
+        }
+    }
+}
+
+std::vector<uint32_t> SceneBvh::FindItems(const pxr::SdfPath &path) const
+{
+    // Sorted paths keep a prim's descendants right after it
+    auto it = std::lower_bound(m_byPath.begin(), m_byPath.end(), path,
+                               [this](uint32_t i, const pxr::SdfPath &p) { return m_items[i].path < p; });
+    std::vector<uint32_t> items;
+    for (; it != m_byPath.end() && m_items[*it].path.HasPrefix(path); ++it)
+    {
+        items.push_back(*it);
+    }
+    return items;
+}
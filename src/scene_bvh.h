@@ -0,0 +1,77 @@
+#pragma once
+
+// Standard Library Headers
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+// Third-Party Library Headers
+#include <glm/glm.hpp>
+
+// Project Headers
+#include "usd_headers.h"
+
+// SceneBvh Class
+//
+// A bounding volume hierarchy over the world bounds of every gprim (and point instancer) of a stage, for
+// picking and framing on the CPU without reading anything back from the GPU. The bounds are computed in
+// parallel and the tree is built in parallel, so it can be built on the loader thread after each load.
+// Prims are identified by path, so a hierarchy built on one stage serves any stage composing the same scene.
+//
+// Stage edits are not applied right away: transform and geometry edits mark the affected prims, and the next
+// query refits just those (or everything animated, when the time changed). Structural changes rebuild it.
+class SceneBvh
+{
+  public:
+    /// Computes the bounds of the stage's gprims at `time` and builds the hierarchy over them.
+    void Build(const pxr::UsdStageRefPtr &stage, pxr::UsdTimeCode time);
+
+    /// Marks prims whose transform or geometry changed for a refit, or everything for a rebuild when prims
+    /// were added or removed.
+    void OnObjectsChanged(const pxr::UsdNotice::ObjectsChanged &notice);
+
+    /// Casts a ray and returns the path of the nearest gprim it hits. Meshes are hit-tested against their
+    /// triangles; other prims against their bounds.
+    bool Pick(const pxr::UsdStageRefPtr &stage, pxr::UsdTimeCode time, const glm::vec3 &origin,
+              const glm::vec3 &direction, pxr::SdfPath &path);
+
+    /// World bounds of the gprims at or below `path`, or of the whole scene for the absolute root path.
+    bool GetBounds(const pxr::UsdStageRefPtr &stage, pxr::UsdTimeCode time, const pxr::SdfPath &path,
+                   glm::vec3 &minBounds, glm::vec3 &maxBounds);
+
+  private:
+    struct Item
+    {
+        pxr::SdfPath path;
+        pxr::GfMatrix4d localToWorld;
+        glm::vec3 min{0.0f};
+        glm::vec3 max{0.0f};
+        bool animated = false; // Bounds may change with time
+    };
+
+    // Children of an inner node are at `first` and `first + 1`; a leaf holds `count` entries of m_order
+    struct Node
+    {
+        glm::vec3 min{0.0f};
+        uint32_t first = 0;
+        glm::vec3 max{0.0f};
+        uint32_t count = 0;
+    };
+
+    void Update(const pxr::UsdStageRefPtr &stage, pxr::UsdTimeCode time);
+    void ComputeBounds(const pxr::UsdStageRefPtr &stage, pxr::UsdTimeCode time, const std::vector<uint32_t> &items);
+    void BuildNodes();
+    void BuildSubtree(uint32_t index, uint32_t begin, uint32_t end, std::atomic<uint32_t> &nodeCount);
+    void RefitNodes();
+    std::vector<uint32_t> FindItems(const pxr::SdfPath &path) const;
+
+    std::vector<Item> m_items;
+    std::vector<uint32_t> m_order;  // Item indices, grouped by leaf
+    std::vector<uint32_t> m_byPath; // Item indices sorted by path, for finding the prims below a path
+    std::vector<Node> m_nodes;      // Parents come before their children; m_nodes[0] is the root
+    pxr::UsdTimeCode m_time = pxr::UsdTimeCode::Default();
+
+    // Pending Edits
+    bool m_rebuild = false;
+    pxr::SdfPathSet m_dirtyPaths;
+};
@@ -0,0 +1,163 @@
+// Standard Library Headers
+#include <iostream>
+#include <iterator>
+#include <set>
+#include <system_error>
+
+// Project Headers
+#include "scene_cache.h"
+
+//----------------------------------------------------------------------
+// SceneCache Class Implementation
+
+SceneCache::SceneCache(size_t diskBudgetBytes) : m_diskBudgetBytes(diskBudgetBytes)
+{
+}
+
+bool SceneCache::Find(const SceneRequest &request, LoadedScene &scene)
+{
+    std::list<Entry> stale; // Declared before the lock, so its layers are closed after the lock is released
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto it = m_entries.begin(); it != m_entries.end(); ++it)
+    {
+        if (it->request != request)
+        {
+            continue;
+        }
+
+        // A layer was edited on disk since Refresh() last looked; load the scene again
+        if (!IsUnchanged(it->fileTimes))
+        {
+            std::cout << "Scene cache: " << request.filename << " changed on disk" << std::endl;
+            m_totalDiskBytes -= it->diskBytes;
+            stale.splice(stale.begin(), m_entries, it);
+            return false;
+        }
+
+        m_entries.splice(m_entries.begin(), m_entries, it);
+        scene = m_entries.front().scene;
+        return true;
+    }
+    return false;
+}
+
+void SceneCache::Insert(const SceneRequest &request, const LoadedScene &scene)
+{
+    Entry entry;
+    entry.request = request;
+    entry.scene = scene;
+    entry.scene.stage = nullptr; // The viewer edits the stage it is handed; a hit composes a new one
+    for (const pxr::SdfLayerRefPtr &layer : scene.layers)
+    {
+        // Anonymous layers and layers inside packages have no file of their own
+        std::error_code timeError;
+        std::error_code sizeError;
+        const std::string &path = layer->GetRealPath();
+        auto fileTime = std::filesystem::last_write_time(path, timeError);
+        uintmax_t fileSize = std::filesystem::file_size(path, sizeError);
+        if (timeError || sizeError)
+        {
+            continue;
+        }
+        entry.fileTimes.emplace_back(path, fileTime);
+        entry.diskBytes += static_cast<size_t>(fileSize);
+    }
+
+    std::list<Entry> dropped; // Declared before the lock, so its layers are closed after the lock is released
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto it = m_entries.begin(); it != m_entries.end(); ++it)
+    {
+        if (it->request == request)
+        {
+            m_totalDiskBytes -= it->diskBytes;
+            dropped.splice(dropped.begin(), m_entries, it);
+            break;
+        }
+    }
+
+    m_totalDiskBytes += entry.diskBytes;
+    m_entries.push_front(std::move(entry));
+    Evict(dropped);
+}
+
+void SceneCache::Refresh(const SceneRequest &request)
+{
+    std::list<Entry> stale;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto it = m_entries.begin(); it != m_entries.end(); ++it)
+        {
+            if (it->request == request)
+            {
+                if (!IsUnchanged(it->fileTimes))
+                {
+                    m_totalDiskBytes -= it->diskBytes;
+                    stale.splice(stale.begin(), m_entries, it);
+                }
+                break;
+            }
+        }
+    }
+    if (stale.empty())
+    {
+        return;
+    }
+
+    // Dropping the entry is not enough: layers still open elsewhere (on the viewer's stage, or shared with
+    // another entry) would be handed out again by SdfLayer::FindOrOpen with their old content
+    std::set<std::string> changedPaths;
+    for (const auto &[path, fileTime] : stale.front().fileTimes)
+    {
+        std::error_code error;
+        if (std::filesystem::last_write_time(path, error) != fileTime || error)
+        {
+            changedPaths.insert(path);
+        }
+    }
+    std::set<pxr::SdfLayerHandle> changedLayers;
+    for (const pxr::SdfLayerRefPtr &layer : stale.front().scene.layers)
+    {
+        if (changedPaths.count(layer->GetRealPath()))
+        {
+            changedLayers.insert(layer);
+        }
+    }
+    std::cout << "Scene cache: " << request.filename << " changed on disk, reloading " << changedLayers.size()
+              << " layers" << std::endl;
+    pxr::SdfLayer::ReloadLayers(changedLayers);
+}
+
+void SceneCache::Clear()
+{
+    // Layers are closed after the lock is released, since closing a large scene takes a while
+    std::list<Entry> entries;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        entries.swap(m_entries);
+        m_totalDiskBytes = 0;
+    }
+}
+
+bool SceneCache::IsUnchanged(const FileTimes &fileTimes)
+{
+    for (const auto &[path, fileTime] : fileTimes)
+    {
+        std::error_code error;
+        if (std::filesystem::last_write_time(path, error) != fileTime || error)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void SceneCache::Evict(std::list<Entry> &evicted)
+{
+    // The newest entry stays even if it alone is over budget; the viewer holds its layers anyway
+    while (m_totalDiskBytes > m_diskBudgetBytes && m_entries.size() > 1)
+    {
+        std::cout << "Scene cache: evicting " << m_entries.back().scene.filename << std::endl;
+        m_totalDiskBytes -= m_entries.back().diskBytes;
+        evicted.splice(evicted.end(), m_entries, std::prev(m_entries.end()));
+    }
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+// Standard Library Headers
+#include <cstddef>
+#include <filesystem>
+#include <list>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Project Headers
+#include "scene_loader.h"
+#include "usd_headers.h"
+
+// SceneCache Class
+//
+// Keeps the layers (and computed bounds) of recently loaded scenes open, so switching back to one skips
+// parsing and composition. Entries are keyed by the whole SceneRequest, and validated against
+// the modification time of every layer they hold; the least recently used entries are evicted when the on-disk
+// size of their layers exceeds the budget. This is not their memory: compressed usdc can take several times its
+// file size once open.
+class SceneCache
+{
+  public:
+    // Constructor
+    explicit SceneCache(size_t diskBudgetBytes);
+
+    // Deleted Functions
+    SceneCache(const SceneCache &) = delete;
+    SceneCache &operator=(const SceneCache &) = delete;
+
+    /// Copies the cached scene into `scene` if the request was loaded before and none of its layers changed.
+    /// A changed entry is dropped; call Refresh() first so its layers are reloaded as well.
+    bool Find(const SceneRequest &request, LoadedScene &scene);
+
+    /// Adds a freshly loaded scene as the most recently used entry and evicts others to stay within budget.
+    void Insert(const SceneRequest &request, const LoadedScene &scene);
+
+    /// If the entry for the request has layers that changed on disk, reloads them and drops the entry. Reloading
+    /// edits every stage that uses those layers, so call it on the thread that owns the viewer's stage.
+    void Refresh(const SceneRequest &request);
+
+    /// Drops every entry, closing layers that nothing else holds.
+    void Clear();
+
+  private:
+    using FileTimes = std::vector<std::pair<std::string, std::filesystem::file_time_type>>;
+
+    struct Entry
+    {
+        SceneRequest request; // As requested, before the mask is mapped to the viewer's stage
+        LoadedScene scene;
+        FileTimes fileTimes;
+        size_t diskBytes = 0; // Size of the layer files
+    };
+
+    static bool IsUnchanged(const FileTimes &fileTimes);
+    void Evict(std::list<Entry> &evicted); // Moves entries out, so the caller closes them after unlocking
+
+    std::mutex m_mutex;
+    std::list<Entry> m_entries; // Most recently used first
+    size_t m_diskBudgetBytes;
+    size_t m_totalDiskBytes = 0;
+};
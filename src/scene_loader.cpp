@@ -0,0 +1,532 @@
+// Standard Library Headers
+#include <chrono>
+#include <iostream>
+#include <iterator>
+
+// Project Headers
+#include "memory_resolver.h"
+#include "scene_cache.h"
+#include "scene_loader.h"
+
+//----------------------------------------------------------------------
+// Internal Utility Functions
+
+namespace
+{
+
+constexpr size_t kMaxPlaceholders = 10000;
+
+glm::vec3 ToVec3(const pxr::GfVec3d &v)
+{
+    return glm::vec3(v[0], v[1], v[2]);
+}
+
+// Bounds of component models (or loose gprims), which are coarse enough to draw while Hydra populates
+std::vector<BoundingBox> ComputePlaceholderBounds(const pxr::UsdStageRefPtr &stage, pxr::UsdTimeCode time)
+{
+    pxr::UsdGeomBBoxCache bboxCache(time, pxr::UsdGeomImageable::GetOrderedPurposeTokens(),
+                                    /* useExtentsHint = */ true);
+
+    std::vector<BoundingBox> boxes;
+    pxr::UsdPrimRange range(stage->GetPseudoRoot());
+    for (auto it = range.begin(); it != range.end() && boxes.size() < kMaxPlaceholders; ++it)
+    {
+        if (!it->IsComponent() && !it->IsA<pxr::UsdGeomGprim>())
+        {
+            continue;
+        }
+
+        pxr::GfRange3d bounds = bboxCache.ComputeWorldBound(*it).ComputeAlignedRange();
+        if (!bounds.IsEmpty())
+        {
+            boxes.push_back({ToVec3(bounds.GetMin()), ToVec3(bounds.GetMax())});
+        }
+        it.PruneChildren();
+    }
+    return boxes;
+}
+
+// The requested mask on the viewer's stage; everything if none of its paths are inside the default prim
+pxr::UsdStagePopulationMask MapPopulationMask(const pxr::UsdStagePopulationMask &mask,
+                                              const pxr::SdfPath &defaultPrimPath)
+{
+    if (mask.IsAll())
+    {
+        return mask;
+    }
+
+    pxr::UsdStagePopulationMask mapped;
+    for (const pxr::SdfPath &path : mask.GetPaths())
+    {
+        pxr::SdfPath modelPath = MapToModelPath(path, defaultPrimPath);
+        if (modelPath.IsEmpty())
+        {
+            std::cerr << "Population mask: " << path << " is not under the default prim " << defaultPrimPath
+                      << std::endl;
+            continue;
+        }
+        mapped.Add(modelPath);
+    }
+    if (mapped.IsEmpty())
+    {
+        std::cerr << "Population mask: no paths left; loading the whole scene." << std::endl;
+        return pxr::UsdStagePopulationMask::All();
+    }
+    return mapped;
+}
+
+bool HasProxyPurpose(const pxr::UsdStageRefPtr &stage)
+{
+    for (const pxr::UsdPrim &prim : stage->Traverse())
+    {
+        pxr::UsdGeomImageable imageable(prim);
+        pxr::TfToken purpose;
+        if (imageable && imageable.GetPurposeAttr().Get(&purpose) && purpose == pxr::UsdGeomTokens->proxy)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Composes a cached scene from its open layers, which reads nothing from disk. Instancing opinions go in before
+// the reference, so the scene is composed only once.
+pxr::UsdStageRefPtr ComposeCachedScene(const SceneRequest &request, const LoadedScene &scene,
+                                       std::vector<LoadPhase> &phases)
+{
+    LoadPhaseScope phase(&phases, "Compose Reference");
+    pxr::UsdStageRefPtr stage = CreateSceneStage(request.loadSet, scene.populationMask);
+    if (request.autoInstance)
+    {
+        SetSessionInstanceable(stage, pxr::SdfPath("/World/Model"), scene.instanceCandidates.paths);
+    }
+    SetSceneReference(stage, scene);
+    return stage;
+}
+
+} // namespace
+
+//----------------------------------------------------------------------
+// Scene Bounds
+
+void ComputeSceneBounds(const pxr::UsdStageRefPtr &stage, glm::vec3 &minBounds, glm::vec3 &maxBounds,
+                        pxr::UsdTimeCode time)
+{
+    if (!stage)
+    {
+        std::cerr << "ComputeSceneBounds: stage is null." << std::endl;
+        return;
+    }
+
+    BoundsCache boundsCache(stage);
+    ComputeSceneBounds(boundsCache, minBounds, maxBounds, time);
+}
+
+void ComputeSceneBounds(BoundsCache &boundsCache, glm::vec3 &minBounds, glm::vec3 &maxBounds, pxr::UsdTimeCode time)
+{
+    if (!boundsCache.Compute(time, minBounds, maxBounds))
+    {
+        minBounds = maxBounds = glm::vec3(0.0f);
+    }
+
+    // Print the bounds
+    std::cout << "Scene Bounds: " << minBounds.x << ", " << minBounds.y << ", " << minBounds.z << " to " << maxBounds.x
+              << ", " << maxBounds.y << ", " << maxBounds.z << std::endl;
+}
+
+//----------------------------------------------------------------------
+// Scene Stage
+
+pxr::UsdStageRefPtr CreateSceneStage(pxr::UsdStage::InitialLoadSet loadSet, const pxr::UsdStagePopulationMask &mask)
+{
+    // Create an in‑memory stage; the mask always reaches /World/Model through its paths' ancestors, and the
+    // viewer's dome light is added to it
+    pxr::UsdStagePopulationMask stageMask = mask;
+    if (!stageMask.IsAll())
+    {
+        stageMask.Add(pxr::SdfPath("/World/DomeLight"));
+    }
+    pxr::UsdStageRefPtr stage =
+        pxr::UsdStage::OpenMasked(pxr::SdfLayer::CreateAnonymous(".usda"), stageMask, loadSet);
+
+    // Define a World root, with the Model transform the scene is referenced under
+    stage->DefinePrim(pxr::SdfPath("/World"), pxr::TfToken("Scope"));
+    stage->DefinePrim(pxr::SdfPath("/World/Model"), pxr::TfToken("Xform"));
+    return stage;
+}
+
+void SetSceneReference(const pxr::UsdStageRefPtr &stage, const LoadedScene &scene)
+{
+    pxr::UsdPrim modelPrim = stage->GetPrimAtPath(pxr::SdfPath("/World/Model"));
+    if (!modelPrim)
+    {
+        std::cerr << "SetSceneReference: /World/Model is missing." << std::endl;
+        return;
+    }
+
+    // Match the scene's time codes per second first, otherwise the reference would rescale its time samples
+    stage->SetTimeCodesPerSecond(scene.timeCodesPerSecond);
+    stage->SetFramesPerSecond(scene.framesPerSecond);
+    stage->SetStartTimeCode(scene.startTimeCode);
+    stage->SetEndTimeCode(scene.endTimeCode);
+
+    // Reference the scene under /World/Model
+    modelPrim.GetReferences().SetReferences({pxr::SdfReference(scene.filename)});
+
+    // Rotate Z-up scenes to Y-up
+    pxr::UsdGeomXformable xf(modelPrim);
+    xf.ClearXformOpOrder();
+    if (scene.zUp)
+    {
+        auto rot = xf.AddXformOp(pxr::UsdGeomXformOp::TypeRotateX);
+        rot.Set(-90.0, pxr::UsdTimeCode::Default());
+    }
+}
+
+pxr::SdfPath MapToModelPath(const pxr::SdfPath &path, const pxr::SdfPath &defaultPrimPath)
+{
+    static const pxr::SdfPath kModelPath("/World/Model");
+    if (path.HasPrefix(kModelPath))
+    {
+        return path;
+    }
+    if (!defaultPrimPath.IsEmpty() && path.HasPrefix(defaultPrimPath))
+    {
+        return path.ReplacePrefix(defaultPrimPath, kModelPath);
+    }
+    return pxr::SdfPath();
+}
+
+std::vector<pxr::SdfLayerRefPtr> RetainUsedLayers(const pxr::UsdStageRefPtr &stage)
+{
+    std::vector<pxr::SdfLayerRefPtr> layers;
+    if (stage)
+    {
+        for (const pxr::SdfLayerHandle &layer : stage->GetUsedLayers())
+        {
+            layers.push_back(pxr::TfCreateRefPtrFromProtectedWeakPtr(layer));
+        }
+    }
+    return layers;
+}
+
+//----------------------------------------------------------------------
+// SceneLoader Class Implementation
+
+SceneLoader::SceneLoader(size_t cacheDiskBudgetBytes)
+    : m_cache(cacheDiskBudgetBytes > 0 ? std::make_unique<SceneCache>(cacheDiskBudgetBytes) : nullptr),
+      m_worker(&SceneLoader::WorkerLoop, this)
+{
+}
+
+SceneLoader::~SceneLoader()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_quit = true;
+        m_request.reset();
+    }
+    m_condition.notify_all();
+
+    // A stage that is still being opened cannot be interrupted; wait for it
+    m_worker.join();
+}
+
+LoadedScene SceneLoader::Load(const SceneRequest &request)
+{
+    RefreshCache(request);
+    return LoadCached(request);
+}
+
+LoadedScene SceneLoader::LoadCached(const SceneRequest &request)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    // In-memory buffers get a new URI each time they are registered, so they would never be found again
+    bool useCache = m_cache && !IsMemoryAssetPath(request.filename);
+
+    LoadedScene scene;
+    std::vector<LoadPhase> phases;
+    bool cached = false;
+    if (useCache)
+    {
+        LoadPhaseScope phase(&phases, "Cache Lookup");
+        cached = m_cache->Find(request, scene);
+    }
+    if (cached)
+    {
+        // The cache holds layers, not stages, since the viewer edits the stage it is handed
+        if (m_arena)
+        {
+            m_arena->execute([&] { scene.stage = ComposeCachedScene(request, scene, phases); });
+        }
+        else
+        {
+            scene.stage = ComposeCachedScene(request, scene, phases);
+        }
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        scene.loadSeconds = elapsed.count();
+        scene.phases = std::move(phases);
+        std::cout << "Scene cache hit: " << request.filename << std::endl;
+        return scene;
+    }
+
+    if (m_arena)
+    {
+        m_arena->execute([&] { scene = Open(request); });
+    }
+    else
+    {
+        scene = Open(request);
+    }
+    scene.phases.insert(scene.phases.begin(), phases.begin(), phases.end());
+    if (useCache && !scene.layers.empty())
+    {
+        m_cache->Insert(request, scene);
+    }
+    return scene;
+}
+
+LoadedScene SceneLoader::Open(const SceneRequest &request)
+{
+    auto start = std::chrono::steady_clock::now();
+    const std::string &filename = request.filename;
+
+    LoadedScene scene;
+    scene.filename = filename;
+
+    // Open the scene's root layer stack; it is only used for stage metadata, so no prim is composed (the
+    // reference below composes the scene, and only the masked part of it)
+    pxr::UsdStageRefPtr srcStage;
+    {
+        LoadPhaseScope phase(&scene.phases, "Open Layers");
+        srcStage = pxr::UsdStage::OpenMasked(filename, pxr::UsdStagePopulationMask(), pxr::UsdStage::LoadNone);
+    }
+    if (!srcStage)
+    {
+        std::cerr << "Failed to load stage: " << filename << std::endl;
+        return scene;
+    }
+
+    // Compose the scene under the same wrapper the viewer uses, so bounds match
+    scene.zUp = (pxr::UsdGeomGetStageUpAxis(srcStage) == pxr::UsdGeomTokens->z);
+    scene.startTimeCode = srcStage->GetStartTimeCode();
+    scene.endTimeCode = srcStage->GetEndTimeCode();
+    scene.timeCodesPerSecond = srcStage->GetTimeCodesPerSecond();
+    scene.framesPerSecond = srcStage->GetFramesPerSecond();
+    pxr::TfToken defaultPrim = srcStage->GetRootLayer()->GetDefaultPrim();
+    if (!defaultPrim.IsEmpty())
+    {
+        scene.defaultPrimPath = pxr::SdfPath::AbsoluteRootPath().AppendChild(defaultPrim);
+    }
+    scene.populationMask = MapPopulationMask(request.mask, scene.defaultPrimPath);
+    pxr::UsdStageRefPtr stage = CreateSceneStage(request.loadSet, scene.populationMask);
+    {
+        // Composes the reference, and reads payload layers unless they stay unloaded
+        LoadPhaseScope phase(&scene.phases, "Compose Reference");
+        SetSceneReference(stage, scene);
+    }
+
+    // Bounds for the camera and for placeholders; animated caches may have no default-time values
+    pxr::UsdTimeCode boundsTime =
+        scene.endTimeCode > scene.startTimeCode ? pxr::UsdTimeCode(scene.startTimeCode) : pxr::UsdTimeCode::Default();
+    {
+        LoadPhaseScope phase(&scene.phases, "Scene Bounds");
+        ComputeSceneBounds(stage, scene.minBounds, scene.maxBounds, boundsTime);
+    }
+    {
+        LoadPhaseScope phase(&scene.phases, "Placeholder Bounds");
+        scene.placeholderBounds = ComputePlaceholderBounds(stage, boundsTime);
+    }
+    {
+        LoadPhaseScope phase(&scene.phases, "Proxy Scan");
+        scene.hasProxies = HasProxyPurpose(stage);
+    }
+    {
+        LoadPhaseScope phase(&scene.phases, "Scene Stats");
+        scene.stats = AnalyzeScene(stage);
+    }
+    if (request.autoInstance)
+    {
+        // Walks every prim index and reads the points of each duplicated asset, so only when it is used
+        LoadPhaseScope phase(&scene.phases, "Instance Candidates");
+        scene.instanceCandidates = FindInstanceCandidates(stage);
+    }
+    {
+        LoadPhaseScope phase(&scene.phases, "Pick BVH");
+        auto bvh = std::make_shared<SceneBvh>();
+        bvh->Build(stage, boundsTime);
+        scene.bvh = std::move(bvh);
+    }
+
+    // The viewer takes this stage over, so instancing is applied here rather than on the render thread. The
+    // bounds and hierarchy above are computed without it; instance proxies keep the same paths.
+    if (request.autoInstance && !scene.instanceCandidates.paths.empty())
+    {
+        LoadPhaseScope phase(&scene.phases, "Auto Instance");
+        SetSessionInstanceable(stage, pxr::SdfPath("/World/Model"), scene.instanceCandidates.paths);
+    }
+
+    // The layers are kept for the scene cache
+    scene.layers = RetainUsedLayers(stage);
+    scene.stage = stage;
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    scene.loadSeconds = elapsed.count();
+    return scene;
+}
+
+void SceneLoader::Request(const SceneRequest &request)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_request = request;
+        m_refreshDeferred = true; // The worker waits until the cache entry has been refreshed
+        m_result.reset();
+    }
+
+    // Changed layers are reloaded on this thread, since the worker must not edit layers the viewer's stage may be
+    // using. A load still in flight may be reading them too; the refresh then waits for the worker to finish.
+    RefreshDeferred();
+}
+
+bool SceneLoader::IsRefreshDue() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_refreshDeferred && !m_busy;
+}
+
+void SceneLoader::RefreshDeferred()
+{
+    SceneRequest request;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_refreshDeferred || m_busy)
+        {
+            return;
+        }
+        request = *m_request;
+    }
+
+    // The worker stays idle meanwhile: it only starts a request once the flag is cleared
+    RefreshCache(request);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_refreshDeferred = false;
+    }
+    m_condition.notify_all();
+}
+
+bool SceneLoader::Poll(LoadedScene &scene)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_result)
+    {
+        return false;
+    }
+
+    scene = std::move(*m_result);
+    m_result.reset();
+    return true;
+}
+
+bool SceneLoader::IsLoading() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_busy || m_request.has_value();
+}
+
+void SceneLoader::SetConcurrency(int threads)
+{
+    m_arena = threads > 0 ? std::make_unique<tbb::task_arena>(threads) : nullptr;
+}
+
+void SceneLoader::RefreshCache(const SceneRequest &request)
+{
+    if (m_cache && !IsMemoryAssetPath(request.filename))
+    {
+        m_cache->Refresh(request);
+    }
+}
+
+void SceneLoader::ClearCache()
+{
+    if (m_cache)
+    {
+        m_cache->Clear();
+    }
+}
+
+void SceneLoader::Release(pxr::UsdStageRefPtr stage)
+{
+    if (!stage)
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stageReleaseQueue.push_back(std::move(stage));
+    }
+    m_condition.notify_all();
+}
+
+void SceneLoader::WorkerLoop()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true)
+    {
+        m_condition.wait(lock, [this] {
+            return m_quit || (m_request && !m_refreshDeferred) || !m_releaseQueue.empty() ||
+                   !m_stageReleaseQueue.empty();
+        });
+
+        // Free released stages, then their layers, outside the lock
+        if (!m_releaseQueue.empty() || !m_stageReleaseQueue.empty())
+        {
+            std::vector<pxr::UsdStageRefPtr> releasedStages;
+            std::vector<pxr::SdfLayerRefPtr> released;
+            releasedStages.swap(m_stageReleaseQueue);
+            released.swap(m_releaseQueue);
+            lock.unlock();
+            releasedStages.clear();
+            released.clear();
+            lock.lock();
+        }
+
+        if (m_quit)
+        {
+            break;
+        }
+        if (!m_request || m_refreshDeferred)
+        {
+            continue;
+        }
+
+        SceneRequest request = std::move(*m_request);
+        m_request.reset();
+        m_busy = true;
+        lock.unlock();
+
+        std::cout << "Loading " << request.filename << "..." << std::endl;
+        LoadedScene scene = LoadCached(request);
+
+        lock.lock();
+        m_busy = false;
+
+        // Drop failed loads and results that a newer request has superseded
+        if (!scene.layers.empty() && !m_request && !m_quit)
+        {
+            m_result = std::move(scene);
+        }
+        else
+        {
+            if (scene.stage)
+            {
+                m_stageReleaseQueue.push_back(std::move(scene.stage));
+            }
+            m_releaseQueue.insert(m_releaseQueue.end(), std::make_move_iterator(scene.layers.begin()),
+                                  std::make_move_iterator(scene.layers.end()));
+        }
+    }
+}
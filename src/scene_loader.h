@@ -0,0 +1,163 @@
+#pragma once
+
+// Standard Library Headers
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Third-Party Library Headers
+#include <glm/glm.hpp>
+#include <tbb/task_arena.h>
+
+// Project Headers
+#include "auto_instancer.h"
+#include "bounds_cache.h"
+#include "bounds_overlay.h"
+#include "load_profiler.h"
+#include "scene_bvh.h"
+#include "scene_stats.h"
+#include "usd_headers.h"
+
+// What to load. The scene cache keys its entries by all of it, since each field changes the result.
+struct SceneRequest
+{
+    std::string filename;
+    pxr::UsdStage::InitialLoadSet loadSet = pxr::UsdStage::LoadAll;        // LoadNone leaves payloads for streaming
+    pxr::UsdStagePopulationMask mask = pxr::UsdStagePopulationMask::All(); // Paths in the scene's namespace
+    bool autoInstance = false;                                             // Search for duplicates to instance
+};
+
+inline bool operator==(const SceneRequest &a, const SceneRequest &b)
+{
+    return a.filename == b.filename && a.loadSet == b.loadSet && a.mask == b.mask && a.autoInstance == b.autoInstance;
+}
+
+inline bool operator!=(const SceneRequest &a, const SceneRequest &b)
+{
+    return !(a == b);
+}
+
+// A scene composed on the loader thread, ready for the viewer to take over its stage
+struct LoadedScene
+{
+    std::string filename;
+    pxr::UsdStageRefPtr stage;               // The scene under /World/Model; never kept by the scene cache
+    std::vector<pxr::SdfLayerRefPtr> layers; // Keeps the scene's layers open; empty if loading failed
+    bool zUp = false;
+    glm::vec3 minBounds{0.0f};
+    glm::vec3 maxBounds{0.0f};
+    std::vector<BoundingBox> placeholderBounds; // World-space bounds of the scene's models
+    bool hasProxies = false;                    // Some geometry has purpose "proxy"
+
+    // Partial loading: the scene's default prim (which /World/Model stands in for) and the population mask the
+    // scene was composed with, in the viewer stage's namespace
+    pxr::SdfPath defaultPrimPath;
+    pxr::UsdStagePopulationMask populationMask = pxr::UsdStagePopulationMask::All();
+
+    // Time metadata of the scene's root layer (references don't carry it over to the viewer's stage)
+    double startTimeCode = 0.0;
+    double endTimeCode = 0.0;
+    double timeCodesPerSecond = 24.0;
+    double framesPerSecond = 24.0;
+    double loadSeconds = 0.0;
+    std::vector<LoadPhase> phases;         // Where the load time went, for the load report
+    SceneStats stats;                      // Contents and performance hazards of the composed scene
+    InstanceCandidates instanceCandidates; // Duplicate references to instance; only searched with autoInstance
+    std::shared_ptr<const SceneBvh> bvh;   // Gprim bounds for picking, shared with the scene cache
+};
+
+// Computes the world-space bounds of the whole stage at `time`.
+void ComputeSceneBounds(const pxr::UsdStageRefPtr &stage, glm::vec3 &minBounds, glm::vec3 &maxBounds,
+                        pxr::UsdTimeCode time = pxr::UsdTimeCode::Default());
+
+// Same, reusing whatever the cache still holds from earlier calls.
+void ComputeSceneBounds(BoundsCache &boundsCache, glm::vec3 &minBounds, glm::vec3 &maxBounds,
+                        pxr::UsdTimeCode time = pxr::UsdTimeCode::Default());
+
+// Creates an in-memory stage with the /World/Model prim that scenes are referenced under. Prims outside the
+// mask are never composed, except the viewer's dome light at /World/DomeLight.
+pxr::UsdStageRefPtr CreateSceneStage(pxr::UsdStage::InitialLoadSet loadSet,
+                                     const pxr::UsdStagePopulationMask &mask = pxr::UsdStagePopulationMask::All());
+
+// Maps a path in the scene's namespace to the viewer's stage, where the default prim is /World/Model. Paths that
+// are already on the viewer's stage are kept; prims outside the default prim, which the reference doesn't bring
+// in, map to an empty path.
+pxr::SdfPath MapToModelPath(const pxr::SdfPath &path, const pxr::SdfPath &defaultPrimPath);
+
+// Points /World/Model at the scene's file, rotating Z-up scenes to Y-up, and takes over its time range.
+void SetSceneReference(const pxr::UsdStageRefPtr &stage, const LoadedScene &scene);
+
+// Strong references to every layer the stage uses, so they outlive the stage's composition.
+std::vector<pxr::SdfLayerRefPtr> RetainUsedLayers(const pxr::UsdStageRefPtr &stage);
+
+// Forward Declarations
+class SceneCache;
+
+// SceneLoader Class
+//
+// Opens and composes scenes on a worker thread so the render thread keeps drawing the current scene.
+// Only the most recent request is kept; results of superseded requests are dropped.
+class SceneLoader
+{
+  public:
+    // Constructor and Destructor
+    explicit SceneLoader(size_t cacheDiskBudgetBytes = 0); // On-disk size of the cached layers; 0 disables the cache
+    ~SceneLoader();
+
+    // Deleted Functions
+    SceneLoader(const SceneLoader &) = delete;
+    SceneLoader &operator=(const SceneLoader &) = delete;
+
+    /// Opens the requested file under a /World/Model wrapper on the calling thread and returns the composed stage,
+    /// its layers and bounds, with the candidates marked instanceable if the request asks for it. Only prims in
+    /// the request's mask (paths in the scene's namespace, or already under /World/Model) are composed, and only
+    /// their layers are read. Recently loaded scenes whose files are unchanged come from the cache and are only
+    /// composed again. Layers of a cached scene that changed on disk are reloaded first, which edits the stages
+    /// using them; call Load() and Request() on the thread that owns the viewer's stage, with its readers paused.
+    LoadedScene Load(const SceneRequest &request);
+
+    // Public Interface
+    void Request(const SceneRequest &request);
+    bool Poll(LoadedScene &scene);
+    bool IsLoading() const;
+
+    /// A request made while the worker was still loading waits until its cache entry has been refreshed, which
+    /// must not happen while the worker reads layers. Once the worker is idle, IsRefreshDue() returns true and the
+    /// owner of the viewer's stage calls RefreshDeferred(), under the same rules as Request(), to start it.
+    bool IsRefreshDue() const;
+    void RefreshDeferred();
+
+    /// Runs loads in a TBB arena of `threads` threads, so they don't compete with rendering for workers (0 shares
+    /// the default arena). Call while no load is in progress.
+    void SetConcurrency(int threads);
+
+    /// Forgets cached scenes, so the next load of any scene reads it from disk again.
+    void ClearCache();
+
+    /// Drops the last reference to `stage` on the worker thread; freeing a large scene can take seconds.
+    void Release(pxr::UsdStageRefPtr stage);
+
+  private:
+    static LoadedScene Open(const SceneRequest &request);
+    LoadedScene LoadCached(const SceneRequest &request);
+    void RefreshCache(const SceneRequest &request);
+    void WorkerLoop();
+
+    std::unique_ptr<SceneCache> m_cache;
+    std::unique_ptr<tbb::task_arena> m_arena; // Null to load in the default arena
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_condition;
+    std::optional<SceneRequest> m_request;
+    bool m_refreshDeferred = false; // m_request waits for RefreshDeferred()
+    std::optional<LoadedScene> m_result;
+    std::vector<pxr::SdfLayerRefPtr> m_releaseQueue;
+    std::vector<pxr::UsdStageRefPtr> m_stageReleaseQueue;
+    bool m_busy = false;
+    bool m_quit = false;
+    std::thread m_worker; // Last, so it starts after the state above is constructed
+};
@@ -0,0 +1,333 @@
+// Standard Library Headers
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <unordered_map>
+
+// Project Headers
+#include "scene_stats.h"
+
+//----------------------------------------------------------------------
+// Internal Utility Functions
+
+namespace
+{
+
+constexpr size_t kHeavyMeshPoints = 1000000; // More points than this in one mesh is worth splitting or decimating
+constexpr size_t kDeepXformDepth = 16;       // Transforms above a gprim before its chain counts as deep
+constexpr size_t kRepeatedReferences = 2;    // Uninstanced references to one asset before they are flagged
+constexpr size_t kMaxExamples = 5;           // Paths kept per hazard
+
+// Counts of one chunk of prims, merged into the stats when the chunk is done
+struct ChunkStats
+{
+    SceneStats stats;
+    std::unordered_map<pxr::TfToken, size_t, pxr::TfToken::HashFunctor> primsByType;
+    std::unordered_map<std::string, size_t> references; // Referenced asset and prim path -> referencing prims
+};
+
+void AddHazard(SceneHazard &hazard, const std::string &example)
+{
+    hazard.count++;
+    if (hazard.examples.size() < kMaxExamples)
+    {
+        hazard.examples.push_back(example);
+    }
+}
+
+void MergeHazard(SceneHazard &hazard, const SceneHazard &chunk)
+{
+    hazard.count += chunk.count;
+    hazard.examples.insert(hazard.examples.end(), chunk.examples.begin(), chunk.examples.end());
+}
+
+// Chunks finish in any order; keep the same examples from run to run
+void SortExamples(SceneHazard &hazard)
+{
+    std::sort(hazard.examples.begin(), hazard.examples.end());
+    if (hazard.examples.size() > kMaxExamples)
+    {
+        hazard.examples.resize(kMaxExamples);
+    }
+}
+
+// Number of transformable ancestors of `prim`
+size_t GetXformDepth(const pxr::UsdPrim &prim)
+{
+    size_t depth = 0;
+    for (pxr::UsdPrim parent = prim.GetParent(); parent && !parent.IsPseudoRoot(); parent = parent.GetParent())
+    {
+        if (parent.IsA<pxr::UsdGeomXformable>())
+        {
+            depth++;
+        }
+    }
+    return depth;
+}
+
+// Adds the assets `prim` itself references to `references`. Arcs of its ancestors (such as the viewer's
+// reference to the whole scene) and references nested inside the referenced assets are skipped.
+void CollectReferences(const pxr::UsdPrim &prim, ChunkStats &chunk)
+{
+    for (const pxr::PcpNodeRef &node : prim.GetPrimIndex().GetNodeRange())
+    {
+        if (node.GetArcType() != pxr::PcpArcTypeReference || node.GetDepthBelowIntroduction() != 0 ||
+            IsIntroducedAtPrim(node.GetParentNode()))
+        {
+            continue;
+        }
+
+        const pxr::SdfLayerHandle &layer = node.GetLayerStack()->GetIdentifier().rootLayer;
+        std::string asset = (layer ? layer->GetIdentifier() : std::string()) + "<" + node.GetPath().GetString() + ">";
+        chunk.references[asset]++;
+    }
+}
+
+void AnalyzePrim(const pxr::UsdPrim &prim, ChunkStats &chunk)
+{
+    SceneStats &stats = chunk.stats;
+    stats.primCount++;
+    chunk.primsByType[prim.GetTypeName()]++;
+    if (prim.IsInstance())
+    {
+        stats.instanceCount++;
+    }
+    else if (!prim.IsInPrototype() && prim.HasAuthoredReferences())
+    {
+        CollectReferences(prim, chunk);
+    }
+    if (prim.IsInstanceable())
+    {
+        stats.instanceableCount++;
+    }
+
+    if (!prim.IsA<pxr::UsdGeomGprim>())
+    {
+        return;
+    }
+
+    std::string path = prim.GetPath().GetString();
+    size_t depth = GetXformDepth(prim);
+    if (depth > kDeepXformDepth)
+    {
+        AddHazard(stats.deepXformChains, path + " (" + std::to_string(depth) + " transforms)");
+    }
+    if (!pxr::UsdGeomBoundable(prim).GetExtentAttr().HasAuthoredValue())
+    {
+        AddHazard(stats.missingExtents, path);
+    }
+
+    // Animated geometry may only have time samples; the earliest one stands in for the rest
+    pxr::UsdGeomPointBased pointBased(prim);
+    pxr::VtVec3fArray points;
+    if (pointBased && pointBased.GetPointsAttr().Get(&points, pxr::UsdTimeCode::EarliestTime()))
+    {
+        stats.pointCount += points.size();
+    }
+
+    pxr::UsdGeomMesh mesh(prim);
+    if (mesh)
+    {
+        stats.meshCount++;
+        pxr::VtIntArray faceVertexCounts;
+        if (mesh.GetFaceVertexCountsAttr().Get(&faceVertexCounts, pxr::UsdTimeCode::EarliestTime()))
+        {
+            stats.faceCount += faceVertexCounts.size();
+        }
+        if (points.size() > kHeavyMeshPoints)
+        {
+            AddHazard(stats.heavyMeshes, path + " (" + std::to_string(points.size()) + " points)");
+        }
+    }
+}
+
+void PrintHazard(const char *label, const SceneHazard &hazard)
+{
+    if (hazard.count == 0)
+    {
+        return;
+    }
+    std::printf("  WARNING: %zu %s\n", hazard.count, label);
+    for (const std::string &example : hazard.examples)
+    {
+        std::printf("    %s\n", example.c_str());
+    }
+}
+
+void WriteHazard(pxr::JsWriter &writer, const char *key, const SceneHazard &hazard)
+{
+    writer.WriteKey(key);
+    writer.BeginObject();
+    writer.WriteKeyValue("count", static_cast<uint64_t>(hazard.count));
+    writer.WriteKey("examples");
+    writer.BeginArray();
+    for (const std::string &example : hazard.examples)
+    {
+        writer.WriteValue(example);
+    }
+    writer.EndArray();
+    writer.EndObject();
+}
+
+} // namespace
+
+//----------------------------------------------------------------------
+// Scene Statistics
+
+SceneStats AnalyzeScene(const pxr::UsdStageRefPtr &stage)
+{
+    SceneStats stats;
+    if (!stage)
+    {
+        return stats;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    // Walking the hierarchy is serial, but cheap next to reading attributes, which is spread over the workers.
+    // Instances are not descended into; their prototypes are analyzed once instead.
+    std::vector<pxr::UsdPrim> prims;
+    for (const pxr::UsdPrim &prim : stage->Traverse())
+    {
+        prims.push_back(prim);
+    }
+    std::vector<pxr::UsdPrim> prototypes = stage->GetPrototypes();
+    stats.prototypeCount = prototypes.size();
+    for (const pxr::UsdPrim &prototype : prototypes)
+    {
+        for (const pxr::UsdPrim &prim : pxr::UsdPrimRange(prototype))
+        {
+            if (prim != prototype)
+            {
+                prims.push_back(prim);
+            }
+        }
+    }
+
+    std::mutex mutex;
+    std::unordered_map<pxr::TfToken, size_t, pxr::TfToken::HashFunctor> primsByType;
+    std::unordered_map<std::string, size_t> references;
+    pxr::WorkParallelForN(prims.size(), [&](size_t begin, size_t end) {
+        ChunkStats chunk;
+        for (size_t i = begin; i < end; ++i)
+        {
+            AnalyzePrim(prims[i], chunk);
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        const SceneStats &counts = chunk.stats;
+        stats.primCount += counts.primCount;
+        stats.meshCount += counts.meshCount;
+        stats.pointCount += counts.pointCount;
+        stats.faceCount += counts.faceCount;
+        stats.instanceCount += counts.instanceCount;
+        stats.instanceableCount += counts.instanceableCount;
+        MergeHazard(stats.heavyMeshes, counts.heavyMeshes);
+        MergeHazard(stats.missingExtents, counts.missingExtents);
+        MergeHazard(stats.deepXformChains, counts.deepXformChains);
+        for (const auto &[type, count] : chunk.primsByType)
+        {
+            primsByType[type] += count;
+        }
+        for (const auto &[asset, count] : chunk.references)
+        {
+            references[asset] += count;
+        }
+    });
+
+    for (const auto &[type, count] : primsByType)
+    {
+        stats.primsByType[type.IsEmpty() ? "(untyped)" : type.GetString()] = count;
+    }
+
+    // The same asset referenced by several uninstanced prims is populated into Hydra once per prim
+    for (const auto &[asset, count] : references)
+    {
+        if (count >= kRepeatedReferences)
+        {
+            stats.uninstancedReferences.count += count;
+            stats.uninstancedReferences.examples.push_back(asset + " (" + std::to_string(count) + " prims)");
+        }
+    }
+
+    SortExamples(stats.uninstancedReferences);
+    SortExamples(stats.heavyMeshes);
+    SortExamples(stats.missingExtents);
+    SortExamples(stats.deepXformChains);
+
+    stats.analyzeMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    return stats;
+}
+
+void PrintSceneStats(const SceneStats &stats)
+{
+    std::printf("Scene stats (%.1f ms): %zu prims, %zu meshes, %llu points, %llu faces\n", stats.analyzeMs,
+                stats.primCount, stats.meshCount, static_cast<unsigned long long>(stats.pointCount),
+                static_cast<unsigned long long>(stats.faceCount));
+    std::printf("  %zu instances of %zu prototypes, %zu prims marked instanceable\n", stats.instanceCount,
+                stats.prototypeCount, stats.instanceableCount);
+    for (const auto &[type, count] : stats.primsByType)
+    {
+        std::printf("  %-24s %zu\n", type.c_str(), count);
+    }
+
+    PrintHazard("prims reference an asset that other prims also reference, without instancing:",
+                stats.uninstancedReferences);
+    PrintHazard("meshes have over a million points:", stats.heavyMeshes);
+    PrintHazard("gprims have no authored extent (bounds read their points):", stats.missingExtents);
+    PrintHazard("gprims are nested under deep transform chains:", stats.deepXformChains);
+    std::fflush(stdout);
+}
+
+bool WriteSceneStats(const std::string &filename, const SceneStats &stats)
+{
+    std::ofstream file(filename);
+    if (!file)
+    {
+        std::cerr << "Failed to write scene stats: " << filename << std::endl;
+        return false;
+    }
+
+    pxr::JsWriter writer(file, pxr::JsWriter::Style::Pretty);
+    writer.BeginObject();
+    writer.WriteKeyValue("analyze_ms", stats.analyzeMs);
+    writer.WriteKeyValue("prims", static_cast<uint64_t>(stats.primCount));
+    writer.WriteKeyValue("meshes", static_cast<uint64_t>(stats.meshCount));
+    writer.WriteKeyValue("points", stats.pointCount);
+    writer.WriteKeyValue("faces", stats.faceCount);
+    writer.WriteKeyValue("instances", static_cast<uint64_t>(stats.instanceCount));
+    writer.WriteKeyValue("instanceable", static_cast<uint64_t>(stats.instanceableCount));
+    writer.WriteKeyValue("prototypes", static_cast<uint64_t>(stats.prototypeCount));
+    writer.WriteKey("types");
+    writer.BeginObject();
+    for (const auto &[type, count] : stats.primsByType)
+    {
+        writer.WriteKeyValue(type, static_cast<uint64_t>(count));
+    }
+    writer.EndObject();
+    writer.WriteKey("hazards");
+    writer.BeginObject();
+    WriteHazard(writer, "uninstanced_references", stats.uninstancedReferences);
+    WriteHazard(writer, "heavy_meshes", stats.heavyMeshes);
+    WriteHazard(writer, "missing_extents", stats.missingExtents);
+    WriteHazard(writer, "deep_xform_chains", stats.deepXformChains);
+    writer.EndObject();
+    writer.EndObject();
+    file << "\n";
+    return true;
+}
+
+bool IsIntroducedAtPrim(pxr::PcpNodeRef node)
+{
+    for (; node && !node.IsRootNode(); node = node.GetParentNode())
+    {
+        if (node.GetDepthBelowIntroduction() == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+// Standard Library Headers
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+// Project Headers
+#include "usd_headers.h"
+
+// Prims that match one performance hazard
+struct SceneHazard
+{
+    size_t count = 0;
+    std::vector<std::string> examples; // A few of the prim paths (or assets), with details
+};
+
+// What a stage contains, and what in it is likely to render slowly
+struct SceneStats
+{
+    size_t primCount = 0;
+    std::map<std::string, size_t> primsByType; // Untyped prims are counted as "(untyped)"
+    size_t meshCount = 0;
+    uint64_t pointCount = 0; // Authored points of point-based prims; instance prototypes count once
+    uint64_t faceCount = 0;  // Faces of meshes, counted the same way
+    size_t instanceCount = 0;
+    size_t instanceableCount = 0; // Prims marked instanceable, whether or not they are instanced
+    size_t prototypeCount = 0;
+    double analyzeMs = 0.0;
+
+    // Hazards
+    SceneHazard uninstancedReferences; // Assets referenced by several prims that aren't instanced
+    SceneHazard heavyMeshes;           // Meshes with over a million points
+    SceneHazard missingExtents;        // Gprims without an authored extent, so bounds read their points
+    SceneHazard deepXformChains;       // Gprims nested under more than 16 transforms
+};
+
+// Analyzes the loaded prims of `stage` (and its instance prototypes) in parallel. Only reads the attributes
+// it counts, so it is cheap enough to run after every load.
+SceneStats AnalyzeScene(const pxr::UsdStageRefPtr &stage);
+
+// Prints the counts and any hazards found.
+void PrintSceneStats(const SceneStats &stats);
+
+// Writes the stats as JSON. Returns false if the file cannot be written.
+bool WriteSceneStats(const std::string &filename, const SceneStats &stats);
+
+// True if `node` or a node above it (other than the root) was introduced at the prim itself rather than at one of
+// its ancestors. Opinions from these nodes come from the prim's own references and payloads.
+bool IsIntroducedAtPrim(pxr::PcpNodeRef node);
@@ -0,0 +1,134 @@
+// Standard Library Headers
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+// Project Headers
+#include "timeline.h"
+
+//----------------------------------------------------------------------
+// Timeline Class Implementation
+
+void Timeline::Reset(const pxr::UsdStageRefPtr &stage)
+{
+    m_startTimeCode = stage->GetStartTimeCode();
+    m_endTimeCode = stage->GetEndTimeCode();
+    m_timeCodesPerSecond = stage->GetTimeCodesPerSecond();
+    m_framesPerSecond = stage->GetFramesPerSecond() > 0.0 ? stage->GetFramesPerSecond() : m_timeCodesPerSecond;
+
+    m_playing = false;
+    SetFrame(0);
+}
+
+void Timeline::Play()
+{
+    if (!HasAnimation())
+    {
+        return;
+    }
+
+    m_playing = true;
+    m_playStart = Clock::now();
+    m_playStartFrame = m_unwrappedFrame;
+    m_presentedFrames = 0;
+    m_droppedFrames = 0;
+}
+
+void Timeline::Pause()
+{
+    m_playing = false;
+}
+
+void Timeline::TogglePlay()
+{
+    if (m_playing)
+    {
+        Pause();
+        PrintStats();
+    }
+    else
+    {
+        Play();
+    }
+}
+
+void Timeline::Step(int frames)
+{
+    Pause();
+    SetFrame(m_frame + frames);
+}
+
+void Timeline::SetFrame(int64_t frame)
+{
+    int64_t count = GetFrameCount();
+    m_frame = ((frame % count) + count) % count;
+    m_unwrappedFrame = frame;
+}
+
+bool Timeline::Update()
+{
+    if (!m_playing)
+    {
+        return false;
+    }
+
+    int64_t frame = GetWallClockFrame(Clock::now());
+    if (frame <= m_unwrappedFrame)
+    {
+        return false;
+    }
+
+    // Every frame wall-clock time moved past without being shown was dropped
+    m_droppedFrames += static_cast<uint64_t>(frame - m_unwrappedFrame - 1);
+    m_presentedFrames++;
+    m_unwrappedFrame = frame;
+    m_frame = frame % GetFrameCount();
+    return true;
+}
+
+void Timeline::PrintStats() const
+{
+    uint64_t total = m_presentedFrames + m_droppedFrames;
+    double dropPercent = total > 0 ? 100.0 * m_droppedFrames / total : 0.0;
+    std::cout << "Playback at " << m_framesPerSecond << " fps: " << m_presentedFrames << " frames presented, "
+              << m_droppedFrames << " dropped (" << dropPercent << "%)" << std::endl;
+}
+
+bool Timeline::HasAnimation() const noexcept
+{
+    return m_endTimeCode > m_startTimeCode;
+}
+
+bool Timeline::IsPlaying() const noexcept
+{
+    return m_playing;
+}
+
+pxr::UsdTimeCode Timeline::GetTime() const noexcept
+{
+    return pxr::UsdTimeCode(m_startTimeCode + m_frame * GetFrameStep());
+}
+
+double Timeline::GetFrameStep() const noexcept
+{
+    return m_timeCodesPerSecond / m_framesPerSecond;
+}
+
+double Timeline::GetSecondsToNextFrame() const
+{
+    std::chrono::duration<double> untilNext =
+        std::chrono::duration<double>((m_unwrappedFrame + 1 - m_playStartFrame) / m_framesPerSecond) -
+        (Clock::now() - m_playStart);
+    return std::max(0.0, untilNext.count());
+}
+
+int64_t Timeline::GetFrameCount() const noexcept
+{
+    return std::max<int64_t>(1, static_cast<int64_t>((m_endTimeCode - m_startTimeCode) / GetFrameStep()) + 1);
+}
+
+int64_t Timeline::GetWallClockFrame(Clock::time_point now) const
+{
+    std::chrono::duration<double> elapsed = now - m_playStart;
+    return m_playStartFrame + static_cast<int64_t>(std::floor(elapsed.count() * m_framesPerSecond));
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+// Standard Library Headers
+#include <chrono>
+#include <cstdint>
+
+// Project Headers
+#include "usd_headers.h"
+
+// Timeline Class
+//
+// Plays back a stage's [startTimeCode, endTimeCode] range at its frames-per-second in real time, looping at
+// the end. Frames that wall-clock time skipped over (because rendering could not keep up) are counted as
+// dropped.
+class Timeline
+{
+  public:
+    // Constructor
+    Timeline() = default;
+
+    /// Takes the time range and rates from `stage` and rewinds to its start time code.
+    void Reset(const pxr::UsdStageRefPtr &stage);
+
+    // Playback Control
+    void Play();
+    void Pause();
+    void TogglePlay();
+    void Step(int frames);
+    void SetFrame(int64_t frame);
+
+    /// Advances to the frame wall-clock time says should be showing. Returns true if the time changed.
+    bool Update();
+
+    /// Prints the presented and dropped frame counts since playback started.
+    void PrintStats() const;
+
+    // Accessors
+    bool HasAnimation() const noexcept;
+    bool IsPlaying() const noexcept;
+    pxr::UsdTimeCode GetTime() const noexcept;
+    double GetFrameStep() const noexcept; // Time codes per frame
+    double GetSecondsToNextFrame() const; // While playing; 0 if the next frame is already due
+
+  private:
+    using Clock = std::chrono::steady_clock;
+
+    int64_t GetFrameCount() const noexcept;
+    int64_t GetWallClockFrame(Clock::time_point now) const;
+
+    double m_startTimeCode = 0.0;
+    double m_endTimeCode = 0.0;
+    double m_timeCodesPerSecond = 24.0;
+    double m_framesPerSecond = 24.0;
+
+    // Playback State
+    int64_t m_frame = 0;          // Frames since the start time code, in [0, frame count)
+    int64_t m_unwrappedFrame = 0; // Keeps counting across loops, for drop detection
+    int64_t m_playStartFrame = 0;
+    Clock::time_point m_playStart;
+    bool m_playing = false;
+
+    // Statistics
+    uint64_t m_presentedFrames = 0;
+    uint64_t m_droppedFrames = 0;
+};
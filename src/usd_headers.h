@@ -22,14 +22,56 @@
 #pragma warning(disable : 4305) // truncation from 'type1' to 'type2'
 #endif
 
+#include <pxr/base/arch/fileSystem.h>
+#include <pxr/base/arch/systemInfo.h>
+#include <pxr/base/gf/half.h>
+#include <pxr/base/gf/ray.h>
+#include <pxr/base/js/json.h>
+#include <pxr/base/plug/registry.h>
+#include <pxr/base/trace/collector.h>
+#include <pxr/base/trace/reporter.h>
+#include <pxr/base/work/loops.h>
+#include <pxr/base/work/threadLimits.h>
 #include <pxr/imaging/glf/contextCaps.h>
+#include <pxr/imaging/hd/driver.h>
 #include <pxr/imaging/hdx/tokens.h>
 #include <pxr/imaging/hgi/hgi.h>
+#include <pxr/imaging/hgi/tokens.h>
+#include <pxr/imaging/hgi/types.h>
 #include <pxr/imaging/hgiGL/hgi.h>
 #include <pxr/imaging/hgiInterop/hgiInterop.h>
+#include <pxr/imaging/hio/image.h>
+#include <pxr/imaging/hio/types.h>
+#include <pxr/pxr.h>
+#include <pxr/usd/ar/asset.h>
+#include <pxr/usd/ar/defineResolver.h>
+#include <pxr/usd/ar/resolvedPath.h>
+#include <pxr/usd/ar/resolver.h>
+#include <pxr/usd/ar/timestamp.h>
+#include <pxr/usd/ar/writableAsset.h>
+#include <pxr/usd/pcp/cache.h>
+#include <pxr/usd/pcp/layerStack.h>
+#include <pxr/usd/pcp/layerStackIdentifier.h>
+#include <pxr/usd/pcp/node.h>
+#include <pxr/usd/pcp/primIndex.h>
+#include <pxr/usd/sdf/changeBlock.h>
+#include <pxr/usd/sdf/layerUtils.h>
+#include <pxr/usd/sdf/payload.h>
+#include <pxr/usd/sdf/primSpec.h>
+#include <pxr/usd/sdf/schema.h>
+#include <pxr/usd/usd/notice.h>
+#include <pxr/usd/usd/primRange.h>
 #include <pxr/usd/usd/stage.h>
+#include <pxr/usd/usd/stagePopulationMask.h>
 #include <pxr/usd/usdGeom/bboxCache.h>
+#include <pxr/usd/usdGeom/boundable.h>
+#include <pxr/usd/usdGeom/gprim.h>
+#include <pxr/usd/usdGeom/mesh.h>
 #include <pxr/usd/usdGeom/metrics.h>
+#include <pxr/usd/usdGeom/pointBased.h>
+#include <pxr/usd/usdGeom/pointInstancer.h>
+#include <pxr/usd/usdGeom/xformCache.h>
+#include <pxr/usd/usdGeom/xformable.h>
 #include <pxr/usd/usdLux/domeLight.h>
 #include <pxr/usdImaging/usdImagingGL/engine.h>
 